@@ -0,0 +1,345 @@
+#ifndef BLOCKEDHEAP_HPP
+#define BLOCKEDHEAP_HPP
+
+#include "PriorityQueue.hpp"
+#include "DynamicArray.hpp"
+#include <stdexcept>  // Do obsługi wyjątków
+#include <utility>    // Dla std::pair
+#include <iostream>   // Do wyświetlania
+
+// Kopiec binarny (max) w układzie blokowym (B-heap): drzewo jest pocięte na
+// poddrzewa o wysokości LEVELS, a każde poddrzewo zajmuje jeden blok o rozmiarze
+// BlockBytes. Schodząc w dół kopca zmieniamy blok tylko co LEVELS poziomów,
+// a nie na każdym poziomie jak w układzie klasycznym (dzieci pod 2i+1).
+// Domyślny blok to linia pamięci podręcznej (64 B): przy pamięci z mmap i huge
+// pages chybienia TLB są rzadkie, a liczą się chybienia cache. BlockBytes = 4096
+// daje bloki wielkości strony (mniej chybień TLB bez huge pages).
+// Bloki są wyrównane do BlockBytes tylko w tablicy z mmap (od
+// DynamicArray::MMAP_THRESHOLD, wyrównanie do strony). Mniejsza tablica pochodzi
+// z new[] (wyrównanie 16 B) i blok może leżeć na dwóch liniach cache - taki
+// kopiec i tak mieści się w pamięci podręcznej.
+//
+// Identyfikator węzła: id = blok * SLOTS + pozycja w bloku (układ BFS wewnątrz
+// bloku, ostatnie miejsce bloku pozostaje puste). Liście bloku mają dzieci w
+// blokach potomnych: blok b ma SLOTS bloków-dzieci o numerach b * SLOTS + 1 ...
+// Węzły są zajmowane w kolejności rosnących id, więc rodzic zawsze istnieje
+// przed dzieckiem, a ostatni węzeł jest liściem. Wysokość: O(log n + LEVELS).
+template <typename T, size_t BlockBytes = 64>
+class BlockedHeap : public PriorityQueue<T> {
+public:
+    BlockedHeap();  // Konstruktor
+
+    // Interfejs PriorityQueue
+    void insert(const T& e, int p) override;
+    T extractMax() override;
+    const T& findMax() const override;
+    void modifyKey(const T& e, int p) override;
+    size_t size() const override;
+    bool empty() const override;
+
+    void display() const override;  // Metoda pomocnicza do wyświetlania
+
+    // Zwraca priorytet elementu o najwyższym priorytecie
+    // Złożoność: O(1)
+    int findMaxPriority() const {
+        if (empty()) throw std::runtime_error("Kolejka jest pusta");
+        return heap.getData()[0].second;  // Priorytet korzenia
+    }
+
+private:
+    typedef std::pair<T, int> Entry;  // Para (element, priorytet)
+
+    // Liczba poziomów drzewa w jednym bloku: największe LEVELS, dla którego
+    // 2^LEVELS wpisów mieści się w bloku (co najmniej 2 - dla wpisów większych
+    // niż BlockBytes / 4 blok jest powiększany do 4 wpisów)
+    static constexpr size_t levelsFor(size_t slots) {
+        return slots >= 8 ? 1 + levelsFor(slots / 2) : 2;
+    }
+    static constexpr size_t LEVELS = levelsFor(BlockBytes / sizeof(Entry));
+    static constexpr size_t SLOTS = size_t(1) << LEVELS;  // Miejsca w bloku
+    static constexpr size_t NODES = SLOTS - 1;           // Węzły w bloku
+    static constexpr size_t FIRST_LEAF = NODES / 2;      // Pierwszy liść bloku
+    static_assert(SLOTS * sizeof(Entry) <= BlockBytes || LEVELS == 2,
+                  "BlockedHeap block must not exceed BlockBytes");
+
+    DynamicArray<Entry> heap;  // Bloki po SLOTS wpisów
+    size_t count;              // Liczba elementów w kopcu
+
+    // Identyfikator n-tego węzła (w kolejności zajmowania)
+    static size_t idOf(size_t n) { return (n / NODES) * SLOTS + n % NODES; }
+
+    // Nawigacja po kopcu blokowym
+    static size_t parent(size_t id);
+    static void children(size_t id, size_t& first, size_t& second);
+
+    // Funkcje pomocnicze do utrzymywania własności kopca
+    void heapifyUp(size_t id);
+    void heapifyDown(size_t id);
+    void heapifyDownFloyd(size_t id);  // Wariant Floyda dla extractMax
+
+    // Znajduje identyfikator węzła z elementem
+    // Złożoność: O(n) - liniowe przeszukiwanie
+    size_t findElementId(const T& e) const;
+};
+
+// Implementacja metod szablonowych
+
+template <typename T, size_t BlockBytes>
+BlockedHeap<T, BlockBytes>::BlockedHeap() : count(0) {
+    heap.setUseMmap(true);  // Duże kopce w pamięci z mmap (wyrównanie do stron, huge pages)
+}
+
+/**
+ * Zwraca identyfikator rodzica węzła
+ * Złożoność: O(1)
+ */
+template <typename T, size_t BlockBytes>
+size_t BlockedHeap<T, BlockBytes>::parent(size_t id) {
+    size_t local = id & (SLOTS - 1);
+    if (local > 0) {
+        return (id - local) + (local - 1) / 2;  // Rodzic w tym samym bloku
+    }
+    // Korzeń bloku: rodzicem jest liść bloku nadrzędnego
+    size_t rank = (id >> LEVELS) - 1;            // Numer bloku wśród rodzeństwa
+    size_t parentBlock = rank >> LEVELS;
+    return (parentBlock << LEVELS) + FIRST_LEAF + ((rank & (SLOTS - 1)) >> 1);
+}
+
+/**
+ * Wyznacza identyfikatory obu dzieci węzła (second > first)
+ * Złożoność: O(1)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::children(size_t id, size_t& first, size_t& second) {
+    size_t local = id & (SLOTS - 1);
+    if (local < FIRST_LEAF) {
+        first = id + local + 1;  // 2 * local + 1 w tym samym bloku
+        second = first + 1;
+        return;
+    }
+    // Liść bloku: dzieci są korzeniami dwóch kolejnych bloków potomnych
+    size_t childBlock = (id >> LEVELS) * SLOTS + 1 + 2 * (local - FIRST_LEAF);
+    first = childBlock << LEVELS;
+    second = first + SLOTS;
+}
+
+/**
+ * Wstawia nowy element do kopca
+ * param e element do wstawienia
+ * param p priorytet elementu
+ * Złożoność: O(log n)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::insert(const T& e, int p) {
+    size_t id = idOf(count);
+    if (id >= heap.getSize()) {
+        for (size_t i = 0; i < SLOTS; ++i) {
+            heap.push_back(Entry());  // Nowy blok
+        }
+    }
+    heap.getData()[id] = Entry(e, p);
+    ++count;
+    heapifyUp(id);
+}
+
+/**
+ * Usuwa i zwraca element o najwyższym priorytecie
+ * return element o najwyższym priorytecie
+ * Złożoność: O(log n)
+ */
+template <typename T, size_t BlockBytes>
+T BlockedHeap<T, BlockBytes>::extractMax() {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+
+    Entry* h = heap.getData();
+    size_t last = idOf(count - 1);
+    T maxElement = std::move(h[0].first);
+
+    --count;
+    if (count > 0) {
+        h[0] = std::move(h[last]);  // Ostatni liść do korzenia
+        heapifyDownFloyd(0);
+    }
+
+    // Zwolnienie pustego ostatniego bloku
+    if (count % NODES == 0) {
+        for (size_t i = 0; i < SLOTS; ++i) {
+            heap.pop_back();
+        }
+    }
+
+    return maxElement;
+}
+
+/**
+ * Zwraca element o najwyższym priorytecie bez usuwania
+ * return referencja do elementu o najwyższym priorytecie
+ * Złożoność: O(1)
+ */
+template <typename T, size_t BlockBytes>
+const T& BlockedHeap<T, BlockBytes>::findMax() const {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    return heap.getData()[0].first;
+}
+
+/**
+ * Modyfikuje priorytet elementu
+ * parametr e element do zmiany
+ * parametr p nowy priorytet
+ * Złożoność: O(n) dla wyszukiwania + O(log n) dla naprawy = O(n)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::modifyKey(const T& e, int p) {
+    size_t id = findElementId(e);
+    Entry* h = heap.getData();
+    int oldPriority = h[id].second;
+    h[id].second = p;
+
+    if (p > oldPriority) {
+        heapifyUp(id);
+    } else if (p < oldPriority) {
+        heapifyDown(id);
+    }
+}
+
+/**
+ * Zwraca liczbę elementów w kopcu
+ * Złożoność: O(1)
+ */
+template <typename T, size_t BlockBytes>
+size_t BlockedHeap<T, BlockBytes>::size() const {
+    return count;
+}
+
+/**
+ * Sprawdza czy kopiec jest pusty
+ * Złożoność: O(1)
+ */
+template <typename T, size_t BlockBytes>
+bool BlockedHeap<T, BlockBytes>::empty() const {
+    return count == 0;
+}
+
+/**
+ * Przesuwa element w górę metodą "dziury" (jedno przeniesienie na poziom)
+ * Złożoność: O(log n)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::heapifyUp(size_t id) {
+    Entry* h = heap.getData();
+    Entry value = std::move(h[id]);
+    while (id > 0) {
+        size_t up = parent(id);
+        if (!(h[up].second < value.second)) break;
+        h[id] = std::move(h[up]);
+        id = up;
+    }
+    h[id] = std::move(value);
+}
+
+/**
+ * Przesuwa element w dół metodą "dziury", z wyborem większego dziecka bez rozgałęzienia
+ * Złożoność: O(log n)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::heapifyDown(size_t id) {
+    Entry* h = heap.getData();
+    const size_t end = idOf(count - 1) + 1;  // Węzły o id < end istnieją
+    Entry value = std::move(h[id]);
+    size_t first, second;
+    children(id, first, second);
+    while (first < end) {
+        size_t child = first;
+        if (second < end) {
+            size_t pickSecond = static_cast<size_t>(h[first].second < h[second].second);
+            child = first ^ ((first ^ second) & (0 - pickSecond));
+        }
+        if (!(value.second < h[child].second)) break;
+        h[id] = std::move(h[child]);
+        id = child;
+        children(id, first, second);
+    }
+    h[id] = std::move(value);
+}
+
+/**
+ * Wariant Floyda: dziura schodzi do liścia w stronę większego dziecka,
+ * po czym przesiewany element wraca w górę (patrz HeapSift::siftDownFloyd)
+ * Złożoność: O(log n)
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::heapifyDownFloyd(size_t id) {
+    Entry* h = heap.getData();
+    const size_t end = idOf(count - 1) + 1;
+    const size_t start = id;
+    Entry value = std::move(h[id]);
+    size_t first, second;
+    children(id, first, second);
+    while (first < end) {
+        // W odróżnieniu od układu klasycznego węzeł z jednym dzieckiem (korzeń
+        // bloku bez rodzeństwa) może mieć dalszych potomków - schodzimy dalej
+        size_t child = first;
+        if (second < end) {
+            size_t pickSecond = static_cast<size_t>(h[first].second < h[second].second);
+            child = first ^ ((first ^ second) & (0 - pickSecond));
+        }
+        h[id] = std::move(h[child]);
+        id = child;
+        children(id, first, second);
+    }
+    while (id != start) {
+        size_t up = parent(id);
+        if (!(h[up].second < value.second)) break;
+        h[id] = std::move(h[up]);
+        id = up;
+    }
+    h[id] = std::move(value);
+}
+
+/**
+ * Znajduje identyfikator węzła z elementem
+ * Złożoność: O(n)
+ */
+template <typename T, size_t BlockBytes>
+size_t BlockedHeap<T, BlockBytes>::findElementId(const T& e) const {
+    const Entry* h = heap.getData();
+    for (size_t n = 0; n < count; ++n) {
+        size_t id = idOf(n);
+        if (h[id].first == e) {
+            return id;
+        }
+    }
+    throw std::runtime_error("Nie znaleziono elementu w kolejce");
+}
+
+/**
+ * Wyświetla zawartość kopca w porządku malejących priorytetów
+ * Złożoność: O(n log n) - tworzenie kopii i n operacji extractMax
+ */
+template <typename T, size_t BlockBytes>
+void BlockedHeap<T, BlockBytes>::display() const {
+    if (empty()) {
+        std::cout << "Kopiec jest pusty." << std::endl;
+        return;
+    }
+
+    // Utwórz kopię do wyświetlenia
+    BlockedHeap<T, BlockBytes> copy;
+    const Entry* h = heap.getData();
+    for (size_t n = 0; n < count; ++n) {
+        copy.insert(h[idOf(n)].first, h[idOf(n)].second);
+    }
+
+    std::cout << "Zawartosc kopca (element: priorytet):" << std::endl;
+    while (!copy.empty()) {
+        int priority = copy.findMaxPriority();
+        T element = copy.extractMax();
+        std::cout << element << ": " << priority << std::endl;
+    }
+}
+
+#endif // BLOCKEDHEAP_HPP
@@ -0,0 +1,350 @@
+#ifndef BLOCKINGPRIORITYQUEUE_HPP
+#define BLOCKINGPRIORITYQUEUE_HPP
+
+#include "Heap.hpp"
+#include <chrono>              // Dla limitów czasu
+#include <condition_variable>  // Usypianie konsumentów
+#include <coroutine>           // Dla co_await (C++20)
+#include <deque>               // Kolejka oczekujących korutyn
+#include <functional>          // Wykonawca wznowienia korutyny
+#include <mutex>               // Dla std::mutex
+#include <optional>            // Wynik pop po zamknięciu kolejki
+#include <stdexcept>           // Do obsługi wyjątków
+#include <utility>             // Dla std::pair
+#include <vector>              // Wstawianie wielu elementów
+
+// Blokująca kolejka priorytetowa producent-konsument zbudowana na dowolnej
+// kolejce z interfejsem PriorityQueue (domyślnie Heap). Konsument czeka na
+// zmiennej warunkowej zamiast odpytywać empty() w pętli.
+//
+// Budzenie jest wsadowe: producent wywołuje notify tylko wtedy, gdy jakiś
+// konsument śpi i nie został już obudzony dla wcześniej wstawionych
+// elementów - przy zajętych konsumentach wstawianie nie wykonuje notify
+// wcale. notify jest wywoływane po zwolnieniu blokady.
+//
+// popAsync() zwraca obiekt do co_await: korutyna oczekująca na pustej kolejce
+// dostaje element bezpośrednio od producenta, bez zmiennej warunkowej.
+// Wznowienie zleca się wykonawcy podanemu w popAsync (np. wstawiającemu
+// uchwyt do kolejki wątku konsumenta). Bez wykonawcy korutyna jest wznawiana
+// w wątku producenta, wewnątrz push/pushAll/close - jej kod blokuje wtedy
+// producenta aż do następnego zawieszenia.
+//
+// Po close() push rzuca wyjątek, a pop zwraca pozostałe elementy, potem
+// std::nullopt - dla wątków i korutyn czekających w chwili zamknięcia także.
+template <typename T, typename Queue = Heap<T>>
+class BlockingPriorityQueue {
+public:
+    class PopAwaiter;
+
+    // Wykonawca wznowienia: dostaje uchwyt korutyny i wywołuje resume() w wybranym wątku
+    typedef std::function<void(std::coroutine_handle<>)> Executor;
+
+    BlockingPriorityQueue() = default;
+
+    BlockingPriorityQueue(const BlockingPriorityQueue&) = delete;
+    BlockingPriorityQueue& operator=(const BlockingPriorityQueue&) = delete;
+
+    // Wstawia element, budząc konsumenta tylko gdy jest to potrzebne
+    // Złożoność: O(log n)
+    void push(const T& e, int p);
+
+    // Wstawia wiele elementów pod jedną blokadą, z jednym wsadem wybudzeń
+    // Złożoność: O(k log n)
+    void pushAll(const std::vector<std::pair<T, int>>& items);
+
+    // Pobiera element o najwyższym priorytecie, czekając gdy kolejka jest pusta;
+    // std::nullopt gdy kolejka jest zamknięta i pusta
+    // Złożoność: O(log n) + czas oczekiwania
+    std::optional<T> pop();
+
+    // Jak pop, ale czeka najwyżej timeout; std::nullopt także po upływie czasu
+    template <typename Rep, typename Period>
+    std::optional<T> popFor(const std::chrono::duration<Rep, Period>& timeout);
+
+    // Pobiera element bez czekania; std::nullopt gdy kolejka jest pusta
+    // Złożoność: O(log n)
+    std::optional<T> tryPop();
+
+    // Wersja pop dla korutyn: std::optional<T> item = co_await queue.popAsync(executor);
+    // Pusty executor - wznowienie w wątku producenta
+    PopAwaiter popAsync(Executor executor = Executor()) {
+        return PopAwaiter(*this, std::move(executor));
+    }
+
+    // Zamyka kolejkę i budzi wszystkich oczekujących
+    void close();
+
+    bool isClosed() const;
+    size_t size() const;
+    bool empty() const;
+
+    // Obiekt oczekiwania zwracany przez popAsync
+    class PopAwaiter {
+    public:
+        PopAwaiter(BlockingPriorityQueue& queue, Executor executor)
+            : queue(queue), executor(std::move(executor)) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        // Zwraca false (bez zawieszania), gdy element jest dostępny od razu
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return queue.takeOrSuspend(*this, handle);
+        }
+
+        std::optional<T> await_resume() { return std::move(result); }
+
+    private:
+        friend class BlockingPriorityQueue;
+
+        BlockingPriorityQueue& queue;
+        std::optional<T> result;          // Element przekazany przez producenta
+        std::coroutine_handle<> handle;   // Korutyna do wznowienia
+        Executor executor;                // Pusty: wznowienie w wątku producenta
+    };
+
+private:
+    // Korutyna do wznowienia po zwolnieniu blokady; wykonawca jest przeniesiony
+    // z PopAwaiter, bo ten może zniknąć razem z ramką zaraz po wznowieniu
+    struct Resumption {
+        std::coroutine_handle<> handle;
+        Executor executor;
+    };
+
+    Queue queue;                          // Kolejka chroniona przez mutex
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;     // Oczekiwanie wątków konsumentów
+    std::deque<PopAwaiter*> awaiters;     // Zawieszone korutyny (FIFO)
+    size_t sleepers = 0;                  // Wątki czekające na notEmpty
+    size_t signalled = 0;                 // Z nich już obudzone, jeszcze nie aktywne
+    bool closed = false;
+
+    // Pod blokadą: przekazuje elementy czekającym korutynom, zwraca je do wznowienia
+    void handOffToAwaiters(std::vector<Resumption>& ready);
+
+    // Pod blokadą: ile śpiących wątków trzeba obudzić dla nieprzydzielonych elementów
+    size_t claimWakeups();
+
+    // Bez blokady: budzi count wątków i wznawia korutyny (przez ich wykonawców)
+    void wake(size_t count, const std::vector<Resumption>& ready);
+
+    // Pod blokadą: czeka na element lub zamknięcie, do deadline jeśli podano
+    template <typename Clock, typename Duration>
+    std::optional<T> waitAndTake(std::unique_lock<std::mutex>& lock,
+                                 const std::chrono::time_point<Clock, Duration>* deadline);
+
+    bool takeOrSuspend(PopAwaiter& awaiter, std::coroutine_handle<> handle);
+};
+
+// Implementacja metod szablonowych
+
+/**
+ * Wstawia element i budzi konsumenta, jeśli któryś śpi bez przydzielonej pracy
+ * Złożoność: O(log n)
+ */
+template <typename T, typename Queue>
+void BlockingPriorityQueue<T, Queue>::push(const T& e, int p) {
+    std::vector<Resumption> ready;
+    size_t wakeups;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            throw std::runtime_error("Kolejka jest zamknieta");
+        }
+        queue.insert(e, p);
+        handOffToAwaiters(ready);
+        wakeups = claimWakeups();
+    }
+    wake(wakeups, ready);
+}
+
+/**
+ * Wstawia wiele elementów pod jedną blokadą
+ * Złożoność: O(k log n)
+ */
+template <typename T, typename Queue>
+void BlockingPriorityQueue<T, Queue>::pushAll(const std::vector<std::pair<T, int>>& items) {
+    std::vector<Resumption> ready;
+    size_t wakeups;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            throw std::runtime_error("Kolejka jest zamknieta");
+        }
+        for (const std::pair<T, int>& item : items) {
+            queue.insert(item.first, item.second);
+        }
+        handOffToAwaiters(ready);
+        wakeups = claimWakeups();
+    }
+    wake(wakeups, ready);
+}
+
+/**
+ * Pobiera element, czekając gdy kolejka jest pusta
+ * Złożoność: O(log n) + czas oczekiwania
+ */
+template <typename T, typename Queue>
+std::optional<T> BlockingPriorityQueue<T, Queue>::pop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return waitAndTake<std::chrono::steady_clock, std::chrono::steady_clock::duration>(lock, nullptr);
+}
+
+/**
+ * Pobiera element, czekając najwyżej timeout
+ * Złożoność: O(log n) + czas oczekiwania
+ */
+template <typename T, typename Queue>
+template <typename Rep, typename Period>
+std::optional<T> BlockingPriorityQueue<T, Queue>::popFor(
+    const std::chrono::duration<Rep, Period>& timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(mutex);
+    return waitAndTake(lock, &deadline);
+}
+
+/**
+ * Pobiera element bez czekania
+ * Złożoność: O(log n)
+ */
+template <typename T, typename Queue>
+std::optional<T> BlockingPriorityQueue<T, Queue>::tryPop() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    return queue.extractMax();
+}
+
+/**
+ * Zamyka kolejkę: czekające wątki i korutyny dostają std::nullopt
+ * Złożoność: O(w) dla w oczekujących
+ */
+template <typename T, typename Queue>
+void BlockingPriorityQueue<T, Queue>::close() {
+    std::vector<Resumption> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        for (PopAwaiter* awaiter : awaiters) {
+            ready.push_back({awaiter->handle, std::move(awaiter->executor)});  // Wynik pozostaje pusty
+        }
+        awaiters.clear();
+    }
+    notEmpty.notify_all();
+    wake(0, ready);
+}
+
+template <typename T, typename Queue>
+bool BlockingPriorityQueue<T, Queue>::isClosed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+template <typename T, typename Queue>
+size_t BlockingPriorityQueue<T, Queue>::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size();
+}
+
+template <typename T, typename Queue>
+bool BlockingPriorityQueue<T, Queue>::empty() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.empty();
+}
+
+/**
+ * Czekające korutyny dostają elementy od razu (najwyższy priorytet pierwszy),
+ * wznowienie następuje po zwolnieniu blokady
+ * Złożoność: O(k log n) dla k przekazanych elementów
+ */
+template <typename T, typename Queue>
+void BlockingPriorityQueue<T, Queue>::handOffToAwaiters(std::vector<Resumption>& ready) {
+    while (!awaiters.empty() && !queue.empty()) {
+        PopAwaiter* awaiter = awaiters.front();
+        awaiters.pop_front();
+        awaiter->result = queue.extractMax();
+        ready.push_back({awaiter->handle, std::move(awaiter->executor)});
+    }
+}
+
+/**
+ * Liczba wątków do obudzenia: śpiące, jeszcze nieobudzone, ale nie więcej
+ * niż elementów, na które nie czeka już żaden obudzony wątek
+ * Złożoność: O(1)
+ */
+template <typename T, typename Queue>
+size_t BlockingPriorityQueue<T, Queue>::claimWakeups() {
+    size_t idle = sleepers - signalled;
+    size_t unclaimed = queue.size() > signalled ? queue.size() - signalled : 0;
+    size_t count = idle < unclaimed ? idle : unclaimed;
+    signalled += count;
+    return count;
+}
+
+/**
+ * Budzi wątki i wznawia korutyny (wywoływane bez blokady): przez wykonawcę,
+ * a bez niego bezpośrednio w bieżącym wątku
+ */
+template <typename T, typename Queue>
+void BlockingPriorityQueue<T, Queue>::wake(size_t count,
+                                           const std::vector<Resumption>& ready) {
+    for (size_t i = 0; i < count; ++i) {
+        notEmpty.notify_one();
+    }
+    for (const Resumption& resumption : ready) {
+        if (resumption.executor) {
+            resumption.executor(resumption.handle);
+        } else {
+            resumption.handle.resume();
+        }
+    }
+}
+
+/**
+ * Czeka (pod blokadą) aż pojawi się element albo kolejka zostanie zamknięta
+ * parametr deadline limit czasu albo nullptr
+ */
+template <typename T, typename Queue>
+template <typename Clock, typename Duration>
+std::optional<T> BlockingPriorityQueue<T, Queue>::waitAndTake(
+    std::unique_lock<std::mutex>& lock, const std::chrono::time_point<Clock, Duration>* deadline) {
+    while (queue.empty() && !closed) {
+        ++sleepers;
+        bool timedOut = false;
+        if (deadline) {
+            timedOut = notEmpty.wait_until(lock, *deadline) == std::cv_status::timeout;
+        } else {
+            notEmpty.wait(lock);
+        }
+        --sleepers;
+        if (signalled > 0) --signalled;  // Obudzony wątek jest już aktywny (fałszywe
+                                         // wybudzenie najwyżej powoduje nadmiarowy notify)
+        if (timedOut && queue.empty()) break;
+    }
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    return queue.extractMax();
+}
+
+/**
+ * Dla korutyny: pobiera element od razu albo rejestruje ją jako oczekującą
+ * zwraca true, gdy korutyna ma zostać zawieszona
+ */
+template <typename T, typename Queue>
+bool BlockingPriorityQueue<T, Queue>::takeOrSuspend(PopAwaiter& awaiter,
+                                                    std::coroutine_handle<> handle) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!queue.empty()) {
+        awaiter.result = queue.extractMax();
+        return false;
+    }
+    if (closed) {
+        return false;  // Wynik pusty
+    }
+    awaiter.handle = handle;
+    awaiters.push_back(&awaiter);
+    return true;
+}
+
+#endif // BLOCKINGPRIORITYQUEUE_HPP
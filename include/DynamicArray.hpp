@@ -1,37 +1,66 @@
 #ifndef DYNAMICARRAY_HPP
 #define DYNAMICARRAY_HPP
 
-#include <stdexcept>  // Do obsługi wyjątków
+#include <stdexcept>    // Do obsługi wyjątków
+#include <new>          // Dla std::bad_alloc
+#include <utility>      // Dla std::move
+#include <cstring>      // Dla std::memcpy
+#include <type_traits>  // Dla cech typów (relokacja przez memcpy)
+
+#if defined(__linux__)
+#include <sys/mman.h>   // mmap / mremap / madvise
+#include <unistd.h>     // sysconf
+#define DYNAMICARRAY_HAS_MMAP 1
+#else
+#define DYNAMICARRAY_HAS_MMAP 0
+#endif
 
 template <typename T>
 class DynamicArray {
 public:
     // Konstruktor - alokuje początkową pamięć (domyślnie 10 elementów)
     // Złożoność: O(1)
-    DynamicArray() : capacity(10), size(0) {
+    explicit DynamicArray(size_t initialCapacity = DEFAULT_CAPACITY)
+        : capacity(initialCapacity > 0 ? initialCapacity : 1), size(0),
+          growthFactor(2.0), autoShrink(false), useMmap(false), mapped(false), mappedBytes(0) {
         data = new T[capacity];  // Alokacja pamięci
     }
 
     // Destruktor - zwalnia pamięć
     // Złożoność: O(1)
     ~DynamicArray() {
-        delete[] data;  // Zwolnienie zaalokowanej pamięci
+        release();  // Zwolnienie zaalokowanej pamięci
     }
 
     // Dodaje element na końcu tablicy
     // Złożoność: O(1) (amortyzowane), O(n) w przypadku resize
     void push_back(const T& value) {
         if (size >= capacity) {
-            resize();  // Powiększa tablicę 2x gdy brak miejsca
+            resize();  // Powiększa tablicę growthFactor razy gdy brak miejsca
         }
         data[size++] = value;  // Dodanie elementu i inkrementacja rozmiaru
     }
 
+    // Wersja push_back przenosząca element
+    // Złożoność: O(1) (amortyzowane), O(n) w przypadku resize
+    void push_back(T&& value) {
+        if (size >= capacity) {
+            resize();
+        }
+        data[size++] = std::move(value);
+    }
+
     // Usuwa ostatni element
-    // Złożoność: O(1)
+    // Złożoność: O(1) (amortyzowane), O(n) gdy automatyczne zmniejszanie zwalnia pamięć
     void pop_back() {
         if (size == 0) throw std::out_of_range("Array is empty");
         --size;  // Dekrementacja rozmiaru (bez fizycznego usuwania)
+
+        // Histereza: rośniemy przy pełnej tablicy, maleje dopiero przy 1/4 zajętości
+        // (do połowy pojemności), więc naprzemienne push/pop nie powodują realokacji
+        if (autoShrink && capacity > DEFAULT_CAPACITY && size <= capacity / 4) {
+            reallocate(capacity / 2 > DEFAULT_CAPACITY ? capacity / 2 : DEFAULT_CAPACITY);
+        }
     }
 
     // Operator dostępu do elementów z kontrolą zakresu
@@ -48,10 +77,19 @@ public:
         return data[index];  // Zwraca const referencję do elementu
     }
 
+    // Bezpośredni dostęp do bufora (bez kontroli zakresu) - dla pętli wewnętrznych
+    // Złożoność: O(1)
+    T* getData() { return data; }
+    const T* getData() const { return data; }
+
     // Zwraca rozmiar tablicy
     // Złożoność: O(1)
     size_t getSize() const { return size; }
 
+    // Zwraca pojemność tablicy
+    // Złożoność: O(1)
+    size_t getCapacity() const { return capacity; }
+
     // Sprawdza czy tablica jest pusta
     // Złożoność: O(1)
     bool empty() const { return size == 0; }
@@ -62,25 +100,128 @@ public:
         size = 0;  // Reset rozmiaru bez zmiany capacity
     }
 
+    // Zapewnia pojemność co najmniej n elementów (jedna realokacja zamiast wielu)
+    // Złożoność: O(n) gdy potrzebna realokacja, inaczej O(1)
+    void reserve(size_t n) {
+        if (n > capacity) {
+            reallocate(n);
+        }
+    }
+
+    // Zmniejsza pojemność do aktualnego rozmiaru, oddając nadmiar pamięci
+    // Złożoność: O(n)
+    void shrink_to_fit() {
+        size_t target = size > 0 ? size : 1;
+        if (target < capacity) {
+            reallocate(target);
+        }
+    }
+
+    // Ustawia współczynnik wzrostu pojemności (musi być > 1, domyślnie 2)
+    void setGrowthFactor(double factor) {
+        if (!(factor > 1.0)) throw std::invalid_argument("Growth factor must be greater than 1");
+        growthFactor = factor;
+    }
+
+    // Włącza automatyczne zmniejszanie pojemności przy pop_back
+    void setAutoShrink(bool enabled) { autoShrink = enabled; }
+
+    // Włącza przechowywanie dużych tablic (>= MMAP_THRESHOLD bajtów) w pamięci
+    // z mmap: wzrost przez mremap bez kopiowania i podpowiedź dla huge pages.
+    // Działa tylko na Linuksie i tylko dla typów, które można przenieść przez
+    // memcpy (trywialny konstruktor kopiujący i destruktor, np. std::pair<int, int>).
+    void setUseMmap(bool enabled) { useMmap = enabled; }
+
+    static constexpr size_t DEFAULT_CAPACITY = 10;       // Początkowa pojemność
+    static constexpr size_t MMAP_THRESHOLD = 2u << 20;   // 2 MiB - rozmiar huge page
+
 private:
-    T* data;         // Wskaźnik na dane (początek tablicy)
-    size_t capacity; // Całkowita pojemność tablicy
-    size_t size;     // Aktualna liczba elementów w tablicy
+    T* data;            // Wskaźnik na dane (początek tablicy)
+    size_t capacity;    // Całkowita pojemność tablicy
+    size_t size;        // Aktualna liczba elementów w tablicy
+    double growthFactor; // Mnożnik pojemności przy powiększaniu
+    bool autoShrink;    // Czy zmniejszać pojemność przy pop_back
+    bool useMmap;       // Czy duże tablice trzymać w pamięci z mmap
+    bool mapped;        // Czy data pochodzi z mmap (a nie z new[])
+    size_t mappedBytes; // Rozmiar odwzorowania (wielokrotność strony)
 
-    // Powiększa tablicę 2x
-    // Złożoność: O(n) - musi skopiować wszystkie elementy
+    // Powiększa tablicę growthFactor razy
+    // Złożoność: O(n) - musi skopiować wszystkie elementy (poza mremap)
     void resize() {
-        capacity *= 2;  // Podwajamy pojemność
-        T* newData = new T[capacity];  // Nowa tablica
-        
-        // Kopiowanie elementów do nowej tablicy
+        size_t newCapacity = static_cast<size_t>(capacity * growthFactor);
+        if (newCapacity <= capacity) newCapacity = capacity + 1;
+        reallocate(newCapacity);
+    }
+
+    // Czy tablica o danej pojemności ma być przechowywana w mmap
+    bool shouldMap(size_t newCapacity) const {
+        return DYNAMICARRAY_HAS_MMAP && useMmap && std::is_trivially_copy_constructible<T>::value &&
+               std::is_trivially_destructible<T>::value &&
+               newCapacity * sizeof(T) >= MMAP_THRESHOLD;
+    }
+
+    // Zmienia pojemność tablicy na newCapacity (nie mniej niż size)
+    // Złożoność: O(n)
+    void reallocate(size_t newCapacity) {
+        if (newCapacity < size) newCapacity = size;
+#if DYNAMICARRAY_HAS_MMAP
+        if (shouldMap(newCapacity)) {
+            remap(newCapacity);
+            return;
+        }
+#endif
+        T* newData = new T[newCapacity];  // Nowa tablica
+
+        // Przeniesienie elementów do nowej tablicy
         for (size_t i = 0; i < size; ++i) {
-            newData[i] = data[i];  // Kopiowanie elementów
+            newData[i] = std::move(data[i]);
+        }
+
+        release();          // Zwolnienie starej pamięci
+        data = newData;     // Ustawienie nowej tablicy
+        capacity = newCapacity;
+    }
+
+    // Zwalnia bieżący bufor niezależnie od sposobu alokacji
+    void release() {
+#if DYNAMICARRAY_HAS_MMAP
+        if (mapped) {
+            munmap(data, mappedBytes);
+            mapped = false;
+            mappedBytes = 0;
+            return;
+        }
+#endif
+        delete[] data;
+    }
+
+#if DYNAMICARRAY_HAS_MMAP
+    // Realokacja w pamięci z mmap; istniejące odwzorowanie rośnie/maleje przez
+    // mremap, który przenosi strony zamiast kopiować dane
+    // Złożoność: O(n) przy przejściu z new[], inaczej zwykle bez kopiowania
+    void remap(size_t newCapacity) {
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t bytes = (newCapacity * sizeof(T) + page - 1) / page * page;
+
+        void* p;
+        if (mapped) {
+            p = mremap(data, mappedBytes, bytes, MREMAP_MAYMOVE);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+        } else {
+            p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) throw std::bad_alloc();
+            std::memcpy(p, static_cast<const void*>(data), size * sizeof(T));
+            delete[] data;
         }
-        
-        delete[] data;  // Zwolnienie starej pamięci
-        data = newData; // Ustawienie nowej tablicy
+#ifdef MADV_HUGEPAGE
+        madvise(p, bytes, MADV_HUGEPAGE);  // Tylko podpowiedź - błąd nie jest krytyczny
+#endif
+        data = static_cast<T*>(p);
+        mapped = true;
+        mappedBytes = bytes;
+        capacity = bytes / sizeof(T);
     }
+#endif
 };
 
-#endif // DYNAMICARRAY_HPP
\ No newline at end of file
+#endif // DYNAMICARRAY_HPP
@@ -0,0 +1,428 @@
+#ifndef EXTERNALPRIORITYQUEUE_HPP
+#define EXTERNALPRIORITYQUEUE_HPP
+
+#include "PriorityQueue.hpp"
+#include "Heap.hpp"
+#include "DynamicArray.hpp"
+#include "HeapSift.hpp"
+#include <cstdio>       // Dla std::tmpfile, std::fread, std::fwrite
+#include <stdexcept>    // Do obsługi wyjątków
+#include <memory>       // Dla std::unique_ptr
+#include <vector>       // Bufory bloków i lista przebiegów
+#include <algorithm>    // Dla std::sort
+#include <type_traits>  // Dla std::is_trivially_copyable
+#include <iostream>     // Do wyświetlania
+
+// Kolejka priorytetowa w pamięci zewnętrznej dla danych większych niż RAM.
+// Wstawienia trafiają do bufora (Heap) o pojemności bufferCapacity. Pełny
+// bufor jest zapisywany jako posortowany malejąco przebieg (run) do pliku
+// tymczasowego. extractMax wybiera lepszy z: korzenia bufora i czoła
+// przebiegów, które są scalane k-drogowo przez kopiec kursorów. Pliki są
+// czytane i zapisywane sekwencyjnie blokami po ioBlockBytes.
+// Gdy przebiegów jest więcej niż maxRuns, najmniejsze są scalane w jeden.
+//
+// Zużycie pamięci (patrz memoryLimitBytes): bufor bufferCapacity wpisów plus
+// najwyżej maxRuns + 2 bloków ioBlockBytes - po jednym na przebieg, blok
+// zapisywanego przebiegu i blok przebiegu scalonego. Zapis bufora nie tworzy
+// jego kopii. Przy domyślnych ustawieniach bloki to do 66 MiB.
+// Elementy są zapisywane bajt po bajcie - T musi być trywialnie kopiowalny.
+template <typename T>
+class ExternalPriorityQueue : public PriorityQueue<T> {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ExternalPriorityQueue requires a trivially copyable element type");
+
+public:
+    static constexpr size_t DEFAULT_BUFFER_CAPACITY = size_t(1) << 20;  // Elementów w pamięci
+    static constexpr size_t DEFAULT_IO_BLOCK_BYTES = size_t(1) << 20;   // Blok odczytu/zapisu
+    static constexpr size_t DEFAULT_MAX_RUNS = 64;                      // Przebiegów na dysku
+
+    explicit ExternalPriorityQueue(size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY,
+                                   size_t ioBlockBytes = DEFAULT_IO_BLOCK_BYTES,
+                                   size_t maxRuns = DEFAULT_MAX_RUNS);
+
+    // Przebiegi są właścicielami plików tymczasowych
+    ExternalPriorityQueue(const ExternalPriorityQueue&) = delete;
+    ExternalPriorityQueue& operator=(const ExternalPriorityQueue&) = delete;
+
+    // Interfejs PriorityQueue
+    void insert(const T& e, int p) override;
+    T extractMax() override;
+    const T& findMax() const override;
+    void modifyKey(const T& e, int p) override;  // Nieobsługiwane - rzuca wyjątek
+    size_t size() const override;
+    bool empty() const override;
+
+    void display() const override;  // Metoda pomocnicza do wyświetlania
+
+    // Zwraca priorytet elementu o najwyższym priorytecie
+    // Złożoność: O(1)
+    int findMaxPriority() const;
+
+    // Liczba przebiegów na dysku i elementów w nich zapisanych
+    size_t runCount() const { return runs.size(); }
+    size_t spilledCount() const { return spilled; }
+
+    // Górne ograniczenie pamięci zajmowanej przez bufor i bloki przebiegów
+    size_t memoryLimitBytes() const {
+        return bufferCapacity * sizeof(std::pair<T, int>) + (maxRuns + 2) * blockEntries * sizeof(Record);
+    }
+
+private:
+    // Rekord w pliku (bez wypełnienia zależnego od std::pair)
+    struct Record {
+        T element;
+        int priority;
+    };
+
+    // Przebieg: plik tymczasowy z rekordami w kolejności malejących priorytetów,
+    // najpierw zapisywany, potem czytany blokami od początku
+    class Run {
+    public:
+        explicit Run(size_t blockEntries);
+        ~Run() { std::fclose(file); }  // Plik z tmpfile jest usuwany przy zamknięciu
+
+        Run(const Run&) = delete;
+        Run& operator=(const Run&) = delete;
+
+        void write(const Record& record);  // Dopisuje rekord (przez bufor bloku)
+        void finishWriting();              // Kończy zapis i ładuje pierwszy blok
+
+        const Record& head() const { return block[position]; }  // Bieżący rekord
+        bool advance();                    // Przechodzi dalej, false gdy koniec
+        size_t size() const { return remaining; }  // Nieodczytane rekordy
+
+    private:
+        void flushBlock();  // Zapisuje zapełnioną część bloku
+        void loadBlock();   // Wczytuje kolejny blok
+
+        std::vector<Record> block;  // Bufor bloku (zapis albo odczyt), alokowany przed plikiem
+        std::FILE* file;
+        size_t filled = 0;          // Zajęte rekordy w bloku
+        size_t position = 0;        // Bieżący rekord w bloku
+        size_t remaining = 0;       // Rekordy jeszcze nieodczytane
+        size_t unread = 0;          // Rekordy pozostałe w pliku (poza blokiem)
+    };
+
+    // Kopiec kursorów: przebieg o wyższym priorytecie czoła jest "większy"
+    struct RunLess {
+        bool operator()(const Run* a, const Run* b) const {
+            return a->head().priority < b->head().priority;
+        }
+    };
+
+    Heap<T> buffer;                           // Bufor wstawień w pamięci
+    std::vector<std::unique_ptr<Run>> runs;   // Przebiegi na dysku
+    DynamicArray<Run*> cursors;               // Kopiec przebiegów według czoła
+    size_t bufferCapacity;                    // Pojemność bufora
+    size_t blockEntries;                      // Rekordów w bloku wejścia/wyjścia
+    size_t maxRuns;                           // Limit przebiegów przed scaleniem
+    size_t spilled = 0;                       // Elementy w przebiegach
+
+    bool topInBuffer() const;      // Czy maksimum leży w buforze
+    void spillBuffer();            // Zapisuje bufor jako nowy przebieg
+    void mergeSmallestRuns();      // Scala najmniejsze przebiegi w jeden
+    void rebuildCursors();         // Buduje kopiec kursorów od nowa
+    void popCursor(DynamicArray<Run*>& heap);  // Usuwa korzeń kopca kursorów
+};
+
+// Implementacja metod szablonowych
+
+/**
+ * Konstruktor
+ * parametr bufferCapacity liczba elementów trzymanych w pamięci
+ * parametr ioBlockBytes rozmiar bloku odczytu/zapisu pliku
+ * parametr maxRuns liczba przebiegów, po przekroczeniu której są scalane
+ * Złożoność: O(bufferCapacity) - rezerwacja bufora
+ */
+template <typename T>
+ExternalPriorityQueue<T>::ExternalPriorityQueue(size_t bufferCapacity, size_t ioBlockBytes,
+                                                size_t maxRuns)
+    : bufferCapacity(bufferCapacity), maxRuns(maxRuns) {
+    if (bufferCapacity == 0) throw std::invalid_argument("Buffer capacity must be positive");
+    if (maxRuns < 2) throw std::invalid_argument("At least two runs must be allowed");
+    blockEntries = ioBlockBytes / sizeof(Record);
+    if (blockEntries == 0) blockEntries = 1;
+    buffer.reserve(bufferCapacity);
+}
+
+/**
+ * Wstawia nowy element; pełny bufor jest najpierw zapisywany na dysk
+ * Złożoność: O(log n) amortyzowane (zapis bufora to O(B log B) na B wstawień)
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::insert(const T& e, int p) {
+    if (buffer.size() >= bufferCapacity) {
+        spillBuffer();
+    }
+    buffer.insert(e, p);
+}
+
+/**
+ * Usuwa i zwraca element o najwyższym priorytecie
+ * Złożoność: O(log B + log r) dla bufora B i r przebiegów, plus odczyt bloku co blockEntries
+ */
+template <typename T>
+T ExternalPriorityQueue<T>::extractMax() {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    if (topInBuffer()) {
+        return buffer.extractMax();
+    }
+
+    Run* top = cursors.getData()[0];
+    T maxElement = top->head().element;
+    --spilled;
+    if (top->advance()) {
+        HeapSift::siftDown(cursors.getData(), cursors.getSize(), 0, RunLess());
+    } else {
+        // Przebieg wyczerpany - zamknięcie pliku
+        popCursor(cursors);
+        for (size_t i = 0; i < runs.size(); ++i) {
+            if (runs[i].get() == top) {
+                runs[i] = std::move(runs.back());
+                runs.pop_back();
+                break;
+            }
+        }
+    }
+    return maxElement;
+}
+
+/**
+ * Zwraca element o najwyższym priorytecie bez usuwania
+ * Złożoność: O(1)
+ */
+template <typename T>
+const T& ExternalPriorityQueue<T>::findMax() const {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    return topInBuffer() ? buffer.findMax() : cursors.getData()[0]->head().element;
+}
+
+/**
+ * Zwraca priorytet elementu o najwyższym priorytecie
+ * Złożoność: O(1)
+ */
+template <typename T>
+int ExternalPriorityQueue<T>::findMaxPriority() const {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    return topInBuffer() ? buffer.findMaxPriority() : cursors.getData()[0]->head().priority;
+}
+
+/**
+ * Zmiana priorytetu wymagałaby przepisania przebiegów na dysku - nieobsługiwana
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::modifyKey(const T&, int) {
+    throw std::runtime_error("Zmiana priorytetu nie jest obslugiwana w kolejce zewnetrznej");
+}
+
+/**
+ * Zwraca liczbę elementów (w buforze i na dysku)
+ * Złożoność: O(1)
+ */
+template <typename T>
+size_t ExternalPriorityQueue<T>::size() const {
+    return buffer.size() + spilled;
+}
+
+/**
+ * Sprawdza czy kolejka jest pusta
+ * Złożoność: O(1)
+ */
+template <typename T>
+bool ExternalPriorityQueue<T>::empty() const {
+    return buffer.empty() && spilled == 0;
+}
+
+/**
+ * Wyświetla zawartość bufora i podsumowanie przebiegów na dysku
+ * Złożoność: O(B log B)
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::display() const {
+    std::cout << "Bufor w pamieci:" << std::endl;
+    buffer.display();
+    std::cout << "Przebiegi na dysku: " << runs.size()
+              << " (elementow: " << spilled << ")" << std::endl;
+}
+
+/**
+ * Czy element o najwyższym priorytecie leży w buforze (przy remisie - tak)
+ * Złożoność: O(1)
+ */
+template <typename T>
+bool ExternalPriorityQueue<T>::topInBuffer() const {
+    if (cursors.empty()) return true;
+    if (buffer.empty()) return false;
+    return buffer.findMaxPriority() >= cursors.getData()[0]->head().priority;
+}
+
+/**
+ * Zapisuje cały bufor jako przebieg posortowany malejąco
+ * Złożoność: O(B log B) + zapis B rekordów
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::spillBuffer() {
+    if (buffer.empty()) return;
+
+    // Bufor jest sortowany w miejscu i zapisywany bez kopii pośredniej
+    const size_t count = buffer.size();
+    std::unique_ptr<Run> run(new Run(blockEntries));
+    buffer.drainSortedTo([&run](const T& element, int priority) {
+        run->write(Record{element, priority});
+    });
+    run->finishWriting();
+
+    spilled += count;
+    cursors.push_back(run.get());
+    HeapSift::siftUp(cursors.getData(), cursors.getSize() - 1, RunLess());
+    runs.push_back(std::move(run));
+
+    if (runs.size() > maxRuns) {
+        mergeSmallestRuns();
+    }
+}
+
+/**
+ * Scala najmniejsze przebiegi w jeden, aż zostanie maxRuns / 2 przebiegów.
+ * Scalane są zawsze najmniejsze, więc każdy element jest przepisywany
+ * O(log(n / B)) razy w całym czasie życia kolejki.
+ * Złożoność: O(m log r) dla m scalanych rekordów i r scalanych przebiegów
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::mergeSmallestRuns() {
+    std::sort(runs.begin(), runs.end(),
+              [](const std::unique_ptr<Run>& a, const std::unique_ptr<Run>& b) {
+                  return a->size() < b->size();
+              });
+    const size_t fanIn = runs.size() - maxRuns / 2 + 1;
+
+    DynamicArray<Run*> merging(fanIn);
+    for (size_t i = 0; i < fanIn; ++i) {
+        merging.push_back(runs[i].get());
+    }
+    HeapSift::makeHeap(merging.getData(), merging.getSize(), RunLess());
+
+    std::unique_ptr<Run> merged(new Run(blockEntries));
+    while (!merging.empty()) {
+        Run* top = merging.getData()[0];
+        merged->write(top->head());
+        if (top->advance()) {
+            HeapSift::siftDown(merging.getData(), merging.getSize(), 0, RunLess());
+        } else {
+            popCursor(merging);
+        }
+    }
+    merged->finishWriting();
+
+    runs.erase(runs.begin(), runs.begin() + fanIn);  // Zamyka scalone pliki
+    runs.push_back(std::move(merged));
+    rebuildCursors();
+}
+
+/**
+ * Buduje kopiec kursorów ze wszystkich przebiegów
+ * Złożoność: O(r)
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::rebuildCursors() {
+    cursors.clear();
+    for (const std::unique_ptr<Run>& run : runs) {
+        cursors.push_back(run.get());
+    }
+    HeapSift::makeHeap(cursors.getData(), cursors.getSize(), RunLess());
+}
+
+/**
+ * Usuwa korzeń kopca kursorów
+ * Złożoność: O(log r)
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::popCursor(DynamicArray<Run*>& heap) {
+    const size_t last = heap.getSize() - 1;
+    heap.getData()[0] = heap.getData()[last];
+    heap.pop_back();
+    if (last > 1) {
+        HeapSift::siftDown(heap.getData(), last, 0, RunLess());
+    }
+}
+
+/**
+ * Tworzy pusty przebieg z plikiem tymczasowym
+ * Złożoność: O(blockEntries)
+ */
+template <typename T>
+ExternalPriorityQueue<T>::Run::Run(size_t blockEntries)
+    : block(blockEntries), file(std::tmpfile()) {
+    if (file == nullptr) {
+        throw std::runtime_error("Nie mozna utworzyc pliku tymczasowego");
+    }
+}
+
+/**
+ * Dopisuje rekord; pełny blok jest zapisywany jednym wywołaniem fwrite
+ * Złożoność: O(1) amortyzowane
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::Run::write(const Record& record) {
+    block[filled++] = record;
+    ++remaining;
+    if (filled == block.size()) {
+        flushBlock();
+    }
+}
+
+/**
+ * Kończy zapis, przewija plik i wczytuje pierwszy blok
+ * Złożoność: O(blockEntries)
+ */
+template <typename T>
+void ExternalPriorityQueue<T>::Run::finishWriting() {
+    flushBlock();
+    if (std::fflush(file) != 0) {
+        throw std::runtime_error("Blad zapisu pliku tymczasowego");
+    }
+    std::rewind(file);
+    unread = remaining;
+    loadBlock();
+}
+
+/**
+ * Przechodzi do następnego rekordu, wczytując kolejny blok gdy trzeba
+ * zwraca false, gdy przebieg się wyczerpał
+ * Złożoność: O(1) amortyzowane
+ */
+template <typename T>
+bool ExternalPriorityQueue<T>::Run::advance() {
+    --remaining;
+    if (++position == filled) {
+        loadBlock();
+    }
+    return remaining > 0;
+}
+
+template <typename T>
+void ExternalPriorityQueue<T>::Run::flushBlock() {
+    if (filled > 0 && std::fwrite(block.data(), sizeof(Record), filled, file) != filled) {
+        throw std::runtime_error("Blad zapisu pliku tymczasowego");
+    }
+    filled = 0;
+}
+
+template <typename T>
+void ExternalPriorityQueue<T>::Run::loadBlock() {
+    size_t count = unread < block.size() ? unread : block.size();
+    if (count > 0 && std::fread(block.data(), sizeof(Record), count, file) != count) {
+        throw std::runtime_error("Blad odczytu pliku tymczasowego");
+    }
+    unread -= count;
+    filled = count;
+    position = 0;
+}
+
+#endif // EXTERNALPRIORITYQUEUE_HPP
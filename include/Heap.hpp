@@ -3,11 +3,24 @@
 
 #include "PriorityQueue.hpp"
 #include "DynamicArray.hpp"
+#include "HeapSift.hpp"
+#include "ParallelHeapSift.hpp"
+#include "PriorityKey.hpp"
 #include <stdexcept>  // Do obsługi wyjątków
 #include <utility>    // Dla std::pair
 #include <iostream>   // Do wyświetlania
+#include <vector>     // Do przenumerowania sekwencji
+#include <algorithm>  // Dla std::sort
+#include <memory>     // Dla std::unique_ptr
+#include <unordered_map>  // Aktualne klucze w trybie leniwym
+#include <unordered_set>  // Pomijanie duplikatów w trybie leniwym
+#include <type_traits>    // Dla std::conditional_t
 
-template <typename T>
+// Stable == true: elementy o równych priorytetach są zwracane w kolejności
+// wstawiania (FIFO), patrz PriorityKey
+// Lazy == true: dostępny tryb leniwy (setLazyMode). Tylko ta wersja wymaga
+// std::hash<T> - przy Lazy == false kopiec nie zawiera kontenerów haszujących.
+template <typename T, bool Stable = false, bool Lazy = false>
 class Heap : public PriorityQueue<T> {
 public:
     Heap() = default;  // Domyślny konstruktor
@@ -22,15 +35,106 @@ public:
 
     void display() const override;  // Metoda pomocnicza do wyświetlania
 
+    // Usuwa element z kolejki
+    // Złożoność: O(n) (wyszukiwanie), w trybie leniwym O(1) oczekiwane
+    void erase(const T& e);
+
+    // Tryb leniwy: modifyKey i erase zapisują tylko aktualny klucz elementu
+    // w tablicy haszującej - stary wpis zostaje w kopcu jako nieaktualny i jest
+    // pomijany przez extractMax/findMax. Gdy nieaktualne wpisy przekroczą
+    // staleThreshold wszystkich wpisów, kopiec jest przebudowywany w O(n).
+    // Dostępny tylko w Heap<T, Stable, true>: wymaga std::hash<T> i unikalnych
+    // elementów (insert istniejącego elementu działa jak modifyKey).
+    void setLazyMode(bool enabled, double staleThreshold = 0.5);
+    bool isLazyMode() const {
+        if constexpr (Lazy) return liveKeys != nullptr;
+        else return false;
+    }
+
+    // Liczba nieaktualnych wpisów w kopcu (0 poza trybem leniwym)
+    size_t staleCount() const {
+        if constexpr (Lazy) return liveKeys ? heap.getSize() - liveKeys->size() : 0;
+        else return 0;
+    }
+
     // Zwraca priorytet elementu o najwyższym priorytecie
     // Złożoność: O(1)
     int findMaxPriority() const {
         if (empty()) throw std::runtime_error("Kolejka jest pusta");
-        return heap[0].second;  // Priorytet korzenia
+        return Key::priority(heap[0].second);  // Priorytet korzenia
+    }
+
+    // Przegląda k elementów o najwyższych priorytetach w kolejności malejącej,
+    // bez modyfikacji kopca: f(element, priorytet) dla każdego z nich
+    // Złożoność: O(k log k) - przeszukiwany jest tylko front (najwyżej k + 1 węzłów)
+    template <typename F>
+    void forEachTopK(size_t k, F f) const;
+
+    // Zastępuje zawartość kolejki parami (element, priorytet) i buduje kopiec
+    // metodą Floyda na threads wątkach (rozłączne poddrzewa równolegle).
+    // W trybie leniwym powtórzone elementy są scalane (zostaje ostatni wpis).
+    // Złożoność: O(n / threads + threads * log n)
+    void build(const std::vector<std::pair<T, int>>& items, unsigned threads = 1);
+
+    // Opróżnia kolejkę, zwracając pary (element, priorytet) w kolejności
+    // malejących priorytetów (jak kolejne extractMax); tablica kopca jest
+    // sortowana na threads wątkach zamiast n razy przesiewana
+    // Złożoność: O((n log n) / threads + n log threads)
+    std::vector<std::pair<T, int>> drainSorted(unsigned threads = 1);
+
+    // Jak drainSorted, ale bez kopii: tablica kopca jest sortowana w miejscu,
+    // a każdy wpis trafia do f(element, priorytet) przed opróżnieniem kolejki
+    // Złożoność: O((n log n) / threads + n log threads)
+    template <typename F>
+    void drainSortedTo(F f, unsigned threads = 1);
+
+    // Rezerwuje miejsce na n elementów (unika wielokrotnych realokacji przy budowie)
+    // Złożoność: O(n)
+    void reserve(size_t n) { heap.reserve(n); }
+
+    // Oddaje nieużywaną pamięć po opróżnieniu dużej kolejki
+    // Złożoność: O(n)
+    void shrinkToFit() { heap.shrink_to_fit(); }
+
+    // Ustawia politykę pamięci tablicy kopca (patrz DynamicArray)
+    void configureStorage(double growthFactor, bool autoShrink, bool useMmap) {
+        heap.setGrowthFactor(growthFactor);
+        heap.setAutoShrink(autoShrink);
+        heap.setUseMmap(useMmap);
     }
     
 private:
-    DynamicArray<std::pair<T, int>> heap;  // Przechowuje pary (element, priorytet)
+    typedef PriorityKey<Stable> Key;
+    typedef std::pair<T, typename Key::Type> Entry;  // Para (element, klucz priorytetu)
+
+    // Porządek wpisów według klucza (dla silnika HeapSift)
+    struct EntryLess {
+        bool operator()(const Entry& a, const Entry& b) const { return a.second < b.second; }
+    };
+
+    DynamicArray<Entry> heap;      // Przechowuje pary (element, klucz priorytetu)
+    std::uint32_t nextSequence = 0; // Numer kolejny następnego wstawienia (tryb stabilny)
+
+    // Kontenery trybu leniwego; przy Lazy == false zastępuje je pusta struktura,
+    // więc std::hash<T> nie jest potrzebny (cały kod trybu jest za if constexpr)
+    struct NoLazyState {};
+    typedef std::conditional_t<Lazy, std::unordered_map<T, typename Key::Type>, NoLazyState> KeyMap;
+    typedef std::conditional_t<Lazy, std::unordered_set<T>, NoLazyState> ElementSet;
+
+    // Tryb leniwy: aktualny klucz każdego elementu; wpis w kopcu jest aktualny,
+    // gdy jego klucz jest równy kluczowi z mapy. W kopcu zawsze aktualny jest korzeń.
+    std::unique_ptr<KeyMap> liveKeys;
+    double staleThreshold = 0.5;   // Próg udziału nieaktualnych wpisów do przebudowy
+
+    bool isLive(const Entry& entry) const;
+    void popTop();                 // Usuwa korzeń kopca
+    void removeAt(size_t index);   // Usuwa wpis z dowolnej pozycji
+    void purgeTop();               // Usuwa nieaktualne wpisy z wierzchołka
+    void compactIfNeeded();        // Przebudowa po przekroczeniu progu
+    void rebuild();                // Usuwa nieaktualne wpisy i buduje kopiec od nowa
+
+    // Nadaje numery kolejne od zera z zachowaniem kolejności, gdy licznik się kończy
+    void renumberSequences();
     
     // Funkcje pomocnicze do utrzymywania własności kopca
     void heapifyUp(size_t index);    // Przywraca własność kopca w górę
@@ -54,9 +158,22 @@ private:
  * param p priorytet elementu
  * Złożoność: O(log n)
  */
-template <typename T>
-void Heap<T>::insert(const T& e, int p) {
-    heap.push_back({e, p});          // Dodanie na koniec (O(1) amortyzowane)
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::insert(const T& e, int p) {
+    if constexpr (Lazy) {
+        if (liveKeys && liveKeys->count(e)) {
+            modifyKey(e, p);         // Tryb leniwy: elementy są unikalne
+            return;
+        }
+    }
+    if (Stable && nextSequence == 0xFFFFFFFFu) {
+        renumberSequences();         // Co 2^32 wstawień - O(n log n)
+    }
+    typename Key::Type key = Key::make(p, nextSequence++);
+    if constexpr (Lazy) {
+        if (liveKeys) liveKeys->emplace(e, key);
+    }
+    heap.push_back({e, key});        // Dodanie na koniec (O(1) amortyzowane)
     heapifyUp(heap.getSize() - 1);   // Naprawa kopca (O(log n))
 }
 
@@ -65,22 +182,24 @@ void Heap<T>::insert(const T& e, int p) {
  * return element o najwyższym priorytecie
  * Złożoność: O(log n)
  */
-template <typename T>
-T Heap<T>::extractMax() {
+template <typename T, bool Stable, bool Lazy>
+T Heap<T, Stable, Lazy>::extractMax() {
     if (empty()) {
         throw std::runtime_error("Kolejka jest pusta");
     }
     
-    T maxElement = heap[0].first;    // Zapamiętanie elementu korzenia
-    
-    if (heap.getSize() > 1) {
-        heap[0] = heap[heap.getSize() - 1];  // Przeniesienie ostatniego elementu do korzenia
+    Entry* h = heap.getData();         // Dostęp bez kontroli zakresu
+    if constexpr (Lazy) {
+        if (liveKeys) liveKeys->erase(h[0].first);  // Korzeń jest zawsze aktualny
     }
+    T maxElement = std::move(h[0].first);  // Zapamiętanie elementu korzenia
+    popTop();
     
-    heap.pop_back();                 // Usunięcie ostatniego elementu
-    
-    if (!empty()) {
-        heapifyDown(0);              // Naprawa kopca od korzenia (O(log n))
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            purgeTop();
+            compactIfNeeded();
+        }
     }
     
     return maxElement;
@@ -91,8 +210,8 @@ T Heap<T>::extractMax() {
  * return referencja do elementu o najwyższym priorytecie
  * Złożoność: O(1)
  */
-template <typename T>
-const T& Heap<T>::findMax() const {
+template <typename T, bool Stable, bool Lazy>
+const T& Heap<T, Stable, Lazy>::findMax() const {
     if (empty()) {
         throw std::runtime_error("Kolejka jest pusta");
     }
@@ -105,16 +224,35 @@ const T& Heap<T>::findMax() const {
  * parametr p nowy priorytet
  * Złożoność: O(n) dla wyszukiwania + O(log n) dla naprawy = O(n)
  */
-template <typename T>
-void Heap<T>::modifyKey(const T& e, int p) {
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::modifyKey(const T& e, int p) {
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            // Tryb leniwy: nowy wpis z nowym kluczem, stary staje się nieaktualny
+            auto it = liveKeys->find(e);
+            if (it == liveKeys->end()) {
+                throw std::runtime_error("Nie znaleziono elementu w kolejce");
+            }
+            typename Key::Type newKey = Key::withPriority(it->second, p);
+            if (newKey == it->second) return;
+            it->second = newKey;
+            heap.push_back({e, newKey});
+            heapifyUp(heap.getSize() - 1);
+            purgeTop();
+            compactIfNeeded();
+            return;
+        }
+    }
+
     size_t index = findElementIndex(e);  // O(n)
-    int oldPriority = heap[index].second;
-    heap[index].second = p;              // Aktualizacja priorytetu
+    typename Key::Type oldKey = heap[index].second;
+    typename Key::Type newKey = Key::withPriority(oldKey, p);
+    heap[index].second = newKey;         // Aktualizacja priorytetu (numer kolejny bez zmian)
     
     // Naprawa kopca w odpowiednim kierunku
-    if (p > oldPriority) {
+    if (newKey > oldKey) {
         heapifyUp(index);    // O(log n)
-    } else if (p < oldPriority) {
+    } else if (newKey < oldKey) {
         heapifyDown(index);  // O(log n)
     }
 }
@@ -124,8 +262,11 @@ void Heap<T>::modifyKey(const T& e, int p) {
  * zwraca rozmiar kopca
  * Złożoność: O(1)
  */
-template <typename T>
-size_t Heap<T>::size() const {
+template <typename T, bool Stable, bool Lazy>
+size_t Heap<T, Stable, Lazy>::size() const {
+    if constexpr (Lazy) {
+        if (liveKeys) return liveKeys->size();  // Tylko aktualne elementy
+    }
     return heap.getSize();  // Deleguje do DynamicArray
 }
 
@@ -134,8 +275,8 @@ size_t Heap<T>::size() const {
  * zwraca true jeśli kopiec jest pusty
  * Złożoność: O(1)
  */
-template <typename T>
-bool Heap<T>::empty() const {
+template <typename T, bool Stable, bool Lazy>
+bool Heap<T, Stable, Lazy>::empty() const {
     return heap.empty();  // Deleguje do DynamicArray
 }
 
@@ -144,12 +285,9 @@ bool Heap<T>::empty() const {
  * parametr indeks elementu do wyniesienia
  * Złożoność: O(log n)
  */
-template <typename T>
-void Heap<T>::heapifyUp(size_t index) {
-    while (index > 0 && heap[parent(index)].second < heap[index].second) {
-        std::swap(heap[index], heap[parent(index)]);  // Zamiana z rodzicem
-        index = parent(index);                        // Przejście do rodzica
-    }
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::heapifyUp(size_t index) {
+    HeapSift::siftUp(heap.getData(), index, EntryLess());
 }
 
 /**
@@ -157,26 +295,9 @@ void Heap<T>::heapifyUp(size_t index) {
  * parametr "index" indeks elementu do opuszczenia
  * Złożoność: O(log n)
  */
-template <typename T>
-void Heap<T>::heapifyDown(size_t index) {
-    size_t maxIndex = index;
-    size_t left = leftChild(index);
-    size_t right = rightChild(index);
-    
-    // Znajdź największy element spośród rodzica i dzieci
-    if (left < heap.getSize() && heap[left].second > heap[maxIndex].second) {
-        maxIndex = left;
-    }
-    
-    if (right < heap.getSize() && heap[right].second > heap[maxIndex].second) {
-        maxIndex = right;
-    }
-    
-    // Jeśli rodzic nie jest największy, zamień z większym dzieckiem i kontynuuj
-    if (index != maxIndex) {
-        std::swap(heap[index], heap[maxIndex]);
-        heapifyDown(maxIndex);
-    }
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::heapifyDown(size_t index) {
+    HeapSift::siftDown(heap.getData(), heap.getSize(), index, EntryLess());
 }
 
 /**
@@ -185,8 +306,8 @@ void Heap<T>::heapifyDown(size_t index) {
  * zwraca indeks elementu
  * Złożoność: O(n)
  */
-template <typename T>
-size_t Heap<T>::findElementIndex(const T& e) const {
+template <typename T, bool Stable, bool Lazy>
+size_t Heap<T, Stable, Lazy>::findElementIndex(const T& e) const {
     for (size_t i = 0; i < heap.getSize(); ++i) {
         if (heap[i].first == e) {
             return i;
@@ -195,29 +316,344 @@ size_t Heap<T>::findElementIndex(const T& e) const {
     throw std::runtime_error("Nie znaleziono elementu w kolejce");
 }
 
+/**
+ * Usuwa element z kolejki
+ * parametr e element do usunięcia
+ * Złożoność: O(n) dla wyszukiwania + O(log n) dla naprawy; w trybie leniwym
+ * O(1) oczekiwane (plus zdejmowanie nieaktualnych wpisów z wierzchołka)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::erase(const T& e) {
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            if (liveKeys->erase(e) == 0) {
+                throw std::runtime_error("Nie znaleziono elementu w kolejce");
+            }
+            purgeTop();
+            compactIfNeeded();
+            return;
+        }
+    }
+    removeAt(findElementIndex(e));
+}
+
+/**
+ * Włącza lub wyłącza tryb leniwy; w obu przypadkach kopiec jest przebudowywany
+ * Złożoność: O(n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::setLazyMode(bool enabled, double threshold) {
+    static_assert(Lazy, "Lazy mode requires Heap<T, Stable, true>");
+    if constexpr (Lazy) {
+        if (!(threshold > 0.0 && threshold < 1.0)) {
+            throw std::invalid_argument("Stale threshold must be in (0, 1)");
+        }
+        staleThreshold = threshold;
+
+        if (enabled && !liveKeys) {
+            liveKeys.reset(new KeyMap());
+            liveKeys->reserve(heap.getSize());
+            const Entry* h = heap.getData();
+            for (size_t i = 0; i < heap.getSize(); ++i) {
+                (*liveKeys)[h[i].first] = h[i].second;  // Przy duplikatach zostaje jeden
+            }
+            rebuild();
+        } else if (!enabled && liveKeys) {
+            rebuild();
+            liveKeys.reset();
+        }
+    }
+}
+
+/**
+ * Czy wpis jest aktualny (tryb leniwy)
+ * Złożoność: O(1) oczekiwane
+ */
+template <typename T, bool Stable, bool Lazy>
+bool Heap<T, Stable, Lazy>::isLive(const Entry& entry) const {
+    auto it = liveKeys->find(entry.first);
+    return it != liveKeys->end() && it->second == entry.second;
+}
+
+/**
+ * Usuwa korzeń: ostatni wpis trafia do korzenia i jest przesiewany w dół
+ * Złożoność: O(log n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::popTop() {
+    const size_t last = heap.getSize() - 1;
+    if (last > 0) {
+        heap.getData()[0] = std::move(heap.getData()[last]);  // Ostatni element do korzenia
+    }
+    
+    heap.pop_back();                 // Usunięcie ostatniego elementu (może zmniejszyć tablicę)
+    
+    if (last > 1) {
+        // Naprawa kopca od korzenia wariantem Floyda (O(log n))
+        HeapSift::siftDownFloyd(heap.getData(), last, 0, EntryLess());
+    }
+}
+
+/**
+ * Usuwa wpis z pozycji index, wstawiając w jego miejsce ostatni wpis
+ * Złożoność: O(log n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::removeAt(size_t index) {
+    const size_t last = heap.getSize() - 1;
+    if (index != last) {
+        heap.getData()[index] = std::move(heap.getData()[last]);
+    }
+    heap.pop_back();
+    if (index < last) {
+        const Entry* h = heap.getData();
+        if (index > 0 && EntryLess()(h[parent(index)], h[index])) {
+            heapifyUp(index);
+        } else {
+            heapifyDown(index);
+        }
+    }
+}
+
+/**
+ * Zdejmuje nieaktualne wpisy z wierzchołka, aby korzeń był aktualny
+ * Złożoność: O(s log n) dla s zdjętych wpisów
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::purgeTop() {
+    while (!heap.empty() && !isLive(heap.getData()[0])) {
+        popTop();
+    }
+}
+
+/**
+ * Przebudowuje kopiec, gdy nieaktualnych wpisów jest więcej niż próg
+ * Złożoność: O(1), O(n) gdy następuje przebudowa (zamortyzowane na operacje)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::compactIfNeeded() {
+    if (staleCount() > staleThreshold * heap.getSize()) {
+        rebuild();
+    }
+}
+
+/**
+ * Zostawia tylko aktualne wpisy (po jednym na element) i buduje z nich kopiec
+ * metodą Floyda
+ * Złożoność: O(n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::rebuild() {
+    Entry* h = heap.getData();
+    const size_t n = heap.getSize();
+    size_t kept = n;
+
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            // Zachowane elementy są chwilowo usuwane z mapy, więc powtórzony wpis
+            // o tym samym kluczu nie jest już rozpoznany jako aktualny
+            kept = 0;
+            for (size_t i = 0; i < n; ++i) {
+                auto it = liveKeys->find(h[i].first);
+                if (it != liveKeys->end() && it->second == h[i].second) {
+                    liveKeys->erase(it);
+                    if (kept != i) h[kept] = std::move(h[i]);
+                    ++kept;
+                }
+            }
+            for (size_t i = 0; i < kept; ++i) {
+                liveKeys->emplace(h[i].first, h[i].second);
+            }
+        }
+    }
+
+    for (size_t i = kept; i < n; ++i) {
+        heap.pop_back();
+    }
+    HeapSift::makeHeap(heap.getData(), heap.getSize(), EntryLess());
+}
+
+/**
+ * Przenumerowuje sekwencje wpisów na 0..n-1 z zachowaniem ich kolejności.
+ * Relacja między kluczami się nie zmienia, więc własność kopca pozostaje.
+ * Złożoność: O(n log n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::renumberSequences() {
+    if constexpr (Lazy) {
+        if (liveKeys) rebuild();  // Po jednym wpisie na element - klucze w mapie da się odświeżyć
+    }
+    Entry* h = heap.getData();
+    std::vector<size_t> order(heap.getSize());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [h](size_t a, size_t b) {
+        return PriorityKey<true>::sequence(h[a].second) < PriorityKey<true>::sequence(h[b].second);
+    });
+    for (size_t rank = 0; rank < order.size(); ++rank) {
+        Entry& entry = h[order[rank]];
+        entry.second = Key::make(Key::priority(entry.second), static_cast<std::uint32_t>(rank));
+    }
+    nextSequence = static_cast<std::uint32_t>(order.size());
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            for (size_t i = 0; i < heap.getSize(); ++i) {
+                (*liveKeys)[h[i].first] = h[i].second;
+            }
+        }
+    }
+}
+
+/**
+ * Zastępuje zawartość kolejki i buduje kopiec równolegle
+ * parametr items pary (element, priorytet), numery kolejne według kolejności
+ * parametr threads liczba wątków
+ * Złożoność: O(n / threads + threads * log n)
+ */
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::build(const std::vector<std::pair<T, int>>& items, unsigned threads) {
+    // Sprawdzenie przed clear - wyjątek zostawia kolejkę bez zmian
+    if (Stable && items.size() > 0xFFFFFFFFu) {
+        throw std::length_error("Too many elements for stable mode");
+    }
+    heap.clear();
+    heap.reserve(items.size());
+    nextSequence = 0;
+    for (const std::pair<T, int>& item : items) {
+        heap.push_back({item.first, Key::make(item.second, nextSequence++)});
+    }
+
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            liveKeys->clear();
+            liveKeys->reserve(items.size());
+            const Entry* h = heap.getData();
+            for (size_t i = 0; i < heap.getSize(); ++i) {
+                (*liveKeys)[h[i].first] = h[i].second;  // Ostatni wpis elementu jest aktualny
+            }
+            if (liveKeys->size() != heap.getSize()) {
+                rebuild();  // Były powtórzenia - kompakcja i budowa sekwencyjna
+                return;
+            }
+        }
+    }
+
+    HeapSift::makeHeapParallel(heap.getData(), heap.getSize(), EntryLess(), threads);
+}
+
+/**
+ * Opróżnia kolejkę, zwracając jej zawartość posortowaną malejąco
+ * parametr threads liczba wątków sortowania
+ * zwraca pary (element, priorytet) w kolejności malejących priorytetów
+ * Złożoność: O((n log n) / threads + n log threads)
+ */
+template <typename T, bool Stable, bool Lazy>
+std::vector<std::pair<T, int>> Heap<T, Stable, Lazy>::drainSorted(unsigned threads) {
+    std::vector<std::pair<T, int>> result;
+    result.reserve(size());
+    drainSortedTo([&result](T& element, int priority) {
+        result.emplace_back(std::move(element), priority);
+    }, threads);
+    return result;
+}
+
+/**
+ * Opróżnia kolejkę, przekazując wpisy w kolejności malejących priorytetów
+ * parametr f funkcja wywoływana jako f(element, priorytet); element można przenieść
+ * parametr threads liczba wątków sortowania
+ * Złożoność: O((n log n) / threads + n log threads)
+ */
+template <typename T, bool Stable, bool Lazy>
+template <typename F>
+void Heap<T, Stable, Lazy>::drainSortedTo(F f, unsigned threads) {
+    if constexpr (Lazy) {
+        if (liveKeys) {
+            rebuild();  // Tylko aktualne wpisy, po jednym na element
+            liveKeys->clear();
+        }
+    }
+
+    // Kolejność extractMax: malejące klucze
+    auto keyGreater = [](const Entry& a, const Entry& b) { return a.second > b.second; };
+    HeapSift::sortParallel(heap.getData(), heap.getSize(), keyGreater, threads);
+
+    Entry* h = heap.getData();
+    for (size_t i = 0; i < heap.getSize(); ++i) {
+        f(h[i].first, Key::priority(h[i].second));
+    }
+    heap.clear();
+}
+
+/**
+ * Przegląda k największych elementów w kolejności malejących priorytetów.
+ * Front to kopiec indeksów węzłów-kandydatów: po pobraniu najlepszego
+ * wchodzą do niego jego dzieci - każde jest nie większe od rodzica.
+ * W trybie leniwym nieaktualne wpisy i powtórzenia są pomijane.
+ * parametr k liczba elementów do odwiedzenia
+ * parametr f funkcja wywoływana jako f(element, priorytet)
+ * Złożoność: O(k log k), w trybie leniwym dodatkowo O(s log k) dla s pominiętych
+ */
+template <typename T, bool Stable, bool Lazy>
+template <typename F>
+void Heap<T, Stable, Lazy>::forEachTopK(size_t k, F f) const {
+    const Entry* h = heap.getData();
+    const size_t n = heap.getSize();
+    if (k > size()) k = size();
+    if (k == 0) return;
+
+    std::unique_ptr<ElementSet> visitedElements;
+    if constexpr (Lazy) {
+        if (liveKeys) visitedElements.reset(new ElementSet());
+    }
+
+    auto indexLess = [h](size_t a, size_t b) { return h[a].second < h[b].second; };
+    DynamicArray<size_t> frontier(k + 1);
+    frontier.push_back(0);
+    for (size_t visited = 0; visited < k && !frontier.empty();) {
+        size_t* front = frontier.getData();
+        size_t best = front[0];
+        bool report = true;
+        if constexpr (Lazy) {
+            report = !liveKeys || (isLive(h[best]) && visitedElements->insert(h[best].first).second);
+        }
+        if (report) {
+            f(h[best].first, Key::priority(h[best].second));
+            ++visited;
+        }
+
+        // Najlepszy węzeł zastępuje jego lewe dziecko, prawe dziecko dołącza na końcu
+        size_t left = leftChild(best);
+        size_t right = rightChild(best);
+        if (left < n) {
+            front[0] = left;
+            HeapSift::siftDown(front, frontier.getSize(), 0, indexLess);
+            if (right < n) {
+                frontier.push_back(right);
+                HeapSift::siftUp(frontier.getData(), frontier.getSize() - 1, indexLess);
+            }
+        } else {
+            size_t last = frontier.getSize() - 1;
+            front[0] = front[last];
+            frontier.pop_back();
+            if (last > 1) HeapSift::siftDown(front, last, 0, indexLess);
+        }
+    }
+}
+
 /**
  * Wyświetla zawartość kopca w porządku malejących priorytetów
- * Złożoność: O(n log n) - tworzenie kopii i n operacji extractMax
+ * Złożoność: O(n log n) - przegląd frontu bez kopiowania kopca
  */
-template <typename T>
-void Heap<T>::display() const {
+template <typename T, bool Stable, bool Lazy>
+void Heap<T, Stable, Lazy>::display() const {
     if (empty()) {
         std::cout << "Kopiec jest pusty." << std::endl;
         return;
     }
 
-    // Utwórz kopię do wyświetlenia
-    Heap<T> copy;
-    for (size_t i = 0; i < heap.getSize(); ++i) {
-        copy.insert(heap[i].first, heap[i].second);
-    }
-
     std::cout << "Zawartosc kopca (element: priorytet):" << std::endl;
-    while (!copy.empty()) {
-        T element = copy.extractMax();
-        int priority = copy.empty() ? 0 : copy.findMaxPriority();
+    forEachTopK(size(), [](const T& element, int priority) {
         std::cout << element << ": " << priority << std::endl;
-    }
+    });
 }
 
 #endif // HEAP_HPP
\ No newline at end of file
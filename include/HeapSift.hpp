@@ -0,0 +1,129 @@
+#ifndef HEAPSIFT_HPP
+#define HEAPSIFT_HPP
+
+#include <cstddef>  // Dla size_t
+#include <utility>  // Dla std::move
+
+// Silnik przesiewania dla kopca binarnego (max) w układzie tablicowym 0..n-1.
+// Zamiast zamiany (swap) na każdym poziomie przesuwamy "dziurę": jedno
+// przeniesienie na poziom, a przesiewana wartość trafia na miejsce raz, na końcu.
+// Funkcje działają na surowym wskaźniku - bez kontroli zakresu.
+// Predykat less(a, b) zwraca true, gdy a ma niższy priorytet niż b.
+namespace HeapSift {
+
+// Przesuwa element a[index] w górę, aż rodzic nie będzie mniejszy
+// Złożoność: O(log n)
+template <typename E, typename Less>
+void siftUp(E* a, size_t index, Less less) {
+    E value = std::move(a[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!less(a[parent], value)) break;
+        a[index] = std::move(a[parent]);  // Rodzic schodzi do dziury
+        index = parent;
+    }
+    a[index] = std::move(value);
+}
+
+// Przesuwa element a[index] w dół kopca o rozmiarze n
+// Wybór większego dziecka bez rozgałęzienia: child += less(lewe, prawe)
+// Złożoność: O(log n), ok. 2 porównania na poziom
+template <typename E, typename Less>
+void siftDown(E* a, size_t n, size_t index, Less less) {
+    E value = std::move(a[index]);
+    size_t child = 2 * index + 1;
+    while (child + 1 < n) {  // Oboje dzieci istnieją
+        child += static_cast<size_t>(less(a[child], a[child + 1]));
+        if (!less(value, a[child])) break;
+        a[index] = std::move(a[child]);   // Dziecko wchodzi do dziury
+        index = child;
+        child = 2 * index + 1;
+    }
+    if (child + 1 == n && less(value, a[child])) {  // Jedyne (lewe) dziecko
+        a[index] = std::move(a[child]);
+        index = child;
+    }
+    a[index] = std::move(value);
+}
+
+// Wariant Floyda: dziura schodzi aż do liścia zawsze w stronę większego
+// dziecka (bez porównań z przesiewaną wartością), po czym wartość wraca w górę.
+// Przesiewany jest zwykle ostatni liść, który i tak ląduje nisko - dlatego
+// wariant ten potrzebuje ok. log n + O(1) porównań zamiast 2 log n.
+// Złożoność: O(log n)
+template <typename E, typename Less>
+void siftDownFloyd(E* a, size_t n, size_t index, Less less) {
+    E value = std::move(a[index]);
+    const size_t start = index;
+    size_t child = 2 * index + 1;
+    while (child + 1 < n) {
+        child += static_cast<size_t>(less(a[child], a[child + 1]));
+        a[index] = std::move(a[child]);
+        index = child;
+        child = 2 * index + 1;
+    }
+    if (child + 1 == n) {
+        a[index] = std::move(a[child]);
+        index = child;
+    }
+    while (index > start) {  // Powrót w górę, nie wyżej niż punkt startu
+        size_t parent = (index - 1) / 2;
+        if (!less(a[parent], value)) break;
+        a[index] = std::move(a[parent]);
+        index = parent;
+    }
+    a[index] = std::move(value);
+}
+
+// Buduje kopiec z dowolnej tablicy metodą Floyda (od ostatniego rodzica w górę)
+// Złożoność: O(n)
+template <typename E, typename Less>
+void makeHeap(E* a, size_t n, Less less) {
+    for (size_t i = n / 2; i-- > 0;) {
+        siftDown(a, n, i, less);
+    }
+}
+
+// Sortuje kopiec a[0..n-1] rosnąco względem less (największy trafia na koniec)
+// Złożoność: O(n log n)
+template <typename E, typename Less>
+void sortHeap(E* a, size_t n, Less less) {
+    while (n > 1) {
+        --n;
+        E top = std::move(a[0]);
+        a[0] = std::move(a[n]);
+        if (n > 1) siftDownFloyd(a, n, 0, less);
+        a[n] = std::move(top);
+    }
+}
+
+// Sortowanie przez kopcowanie, rosnąco względem less, w miejscu
+// Złożoność: O(n log n), pamięć O(1)
+template <typename E, typename Less>
+void heapSort(E* a, size_t n, Less less) {
+    makeHeap(a, n, less);
+    sortHeap(a, n, less);
+}
+
+// Częściowe sortowanie: k największych (względem less) elementów trafia na
+// początek tablicy w kolejności malejącej, reszta - w dowolnej kolejności.
+// Pomocniczy kopiec minimum k elementów jest budowany w a[0..k-1].
+// Złożoność: O(n log k), pamięć O(1)
+template <typename E, typename Less>
+void partialSort(E* a, size_t n, size_t k, Less less) {
+    if (k > n) k = n;
+    if (k == 0) return;
+    auto greater = [&less](const E& x, const E& y) { return less(y, x); };
+    makeHeap(a, k, greater);  // Korzeń: najmniejszy z dotychczasowych k
+    for (size_t i = k; i < n; ++i) {
+        if (less(a[0], a[i])) {
+            std::swap(a[0], a[i]);
+            siftDown(a, k, 0, greater);
+        }
+    }
+    sortHeap(a, k, greater);  // Rosnąco względem greater, czyli malejąco
+}
+
+} // namespace HeapSift
+
+#endif // HEAPSIFT_HPP
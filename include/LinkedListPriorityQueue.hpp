@@ -2,11 +2,17 @@
 #define LINKEDLISTPRIORITYQUEUE_HPP
 
 #include "PriorityQueue.hpp"
+#include "DynamicArray.hpp"
+#include "HeapSift.hpp"
+#include "PriorityKey.hpp"
 #include <stdexcept>
 #include <iostream>
 
 // Szablon klasy LinkedListPriorityQueue dziedziczący po PriorityQueue
-template <typename T>
+// Przy równych priorytetach zwracany jest element wstawiony najwcześniej (lista
+// jest w kolejności wstawiania). Stable == true porównuje upakowane klucze
+// (PriorityKey) - ta sama kolejność FIFO co w Heap<T, true>.
+template <typename T, bool Stable = false>
 class LinkedListPriorityQueue : public PriorityQueue<T> {
 public:
     LinkedListPriorityQueue();  // Konstruktor
@@ -25,22 +31,25 @@ public:
     // Dodatkowa metoda zwracająca maksymalny priorytet
     int findMaxPriority() const {
         Node* maxNode = findMaxNode();
-        return maxNode->priority;
+        return Key::priority(maxNode->key);
     }
 private:
+    typedef PriorityKey<Stable> Key;
+
     // Wewnętrzna struktura węzła
     struct Node {
-        T element;      // Przechowywany element
-        int priority;   // Priorytet elementu
-        Node* next;     // Wskaźnik na następny węzeł
+        T element;                // Przechowywany element
+        typename Key::Type key;   // Klucz priorytetu elementu
+        Node* next;               // Wskaźnik na następny węzeł
         
         // Konstruktor węzła
-        Node(const T& e, int p) : element(e), priority(p), next(nullptr) {}
+        Node(const T& e, typename Key::Type k) : element(e), key(k), next(nullptr) {}
     };
     
     Node* head;     // Wskaźnik na początek listy
     Node* tail;     // Wskaźnik na koniec listy
     size_t count;   // Licznik elementów
+    std::uint32_t nextSequence; // Numer kolejny następnego wstawienia (tryb stabilny)
     
     // Metody pomocnicze
     Node* findMaxNode() const;       // Znajduje węzeł z maksymalnym priorytetem
@@ -49,13 +58,13 @@ private:
 };
 
 // Konstruktor - inicjalizuje pustą kolejkę
-template <typename T>
-LinkedListPriorityQueue<T>::LinkedListPriorityQueue() 
-    : head(nullptr), tail(nullptr), count(0) {}
+template <typename T, bool Stable>
+LinkedListPriorityQueue<T, Stable>::LinkedListPriorityQueue() 
+    : head(nullptr), tail(nullptr), count(0), nextSequence(0) {}
 
 // Destruktor - zwalnia pamięć wszystkich węzłów
-template <typename T>
-LinkedListPriorityQueue<T>::~LinkedListPriorityQueue() {
+template <typename T, bool Stable>
+LinkedListPriorityQueue<T, Stable>::~LinkedListPriorityQueue() {
     Node* current = head;
     while (current != nullptr) {
         Node* next = current->next;
@@ -65,9 +74,16 @@ LinkedListPriorityQueue<T>::~LinkedListPriorityQueue() {
 }
 
 // Wstawia nowy element z priorytetem na koniec listy
-template <typename T>
-void LinkedListPriorityQueue<T>::insert(const T& e, int p) {
-    Node* newNode = new Node(e, p); // Tworzy nowy węzeł
+template <typename T, bool Stable>
+void LinkedListPriorityQueue<T, Stable>::insert(const T& e, int p) {
+    if (Stable && nextSequence == 0xFFFFFFFFu) {
+        // Licznik się kończy - przenumeruj węzły w kolejności listy (= wstawiania)
+        nextSequence = 0;
+        for (Node* node = head; node != nullptr; node = node->next) {
+            node->key = Key::make(Key::priority(node->key), nextSequence++);
+        }
+    }
+    Node* newNode = new Node(e, Key::make(p, nextSequence++)); // Tworzy nowy węzeł
     if (tail == nullptr) {         // Jeśli kolejka jest pusta
         head = tail = newNode;     // Nowy węzeł jest głową i ogonem
     } else {
@@ -78,8 +94,8 @@ void LinkedListPriorityQueue<T>::insert(const T& e, int p) {
 }
 
 // Usuwa i zwraca element o najwyższym priorytecie
-template <typename T>
-T LinkedListPriorityQueue<T>::extractMax() {
+template <typename T, bool Stable>
+T LinkedListPriorityQueue<T, Stable>::extractMax() {
     Node* maxNode = findMaxNode();  // Znajdź węzeł z maksymalnym priorytetem
     T maxElement = maxNode->element; // Zapisz element
     
@@ -102,35 +118,35 @@ T LinkedListPriorityQueue<T>::extractMax() {
 }
 
 // Zwraca referencję do elementu o najwyższym priorytecie
-template <typename T>
-const T& LinkedListPriorityQueue<T>::findMax() const {
+template <typename T, bool Stable>
+const T& LinkedListPriorityQueue<T, Stable>::findMax() const {
     Node* maxNode = findMaxNode();
     return maxNode->element;
 }
 
 // Modyfikuje priorytet danego elementu
-template <typename T>
-void LinkedListPriorityQueue<T>::modifyKey(const T& e, int p) {
+template <typename T, bool Stable>
+void LinkedListPriorityQueue<T, Stable>::modifyKey(const T& e, int p) {
     Node* node = findNode(e);      // Znajdź węzeł z elementem
-    node->priority = p;            // Zaktualizuj priorytet
+    node->key = Key::withPriority(node->key, p); // Zaktualizuj priorytet
 }
 
 // Zwraca liczbę elementów w kolejce
-template <typename T>
-size_t LinkedListPriorityQueue<T>::size() const {
+template <typename T, bool Stable>
+size_t LinkedListPriorityQueue<T, Stable>::size() const {
     return count;
 }
 
 // Sprawdza czy kolejka jest pusta
-template <typename T>
-bool LinkedListPriorityQueue<T>::empty() const {
+template <typename T, bool Stable>
+bool LinkedListPriorityQueue<T, Stable>::empty() const {
     return head == nullptr;
 }
 
 // Znajduje węzeł z najwyższym priorytetem (przeszukuje całą listę)
-template <typename T>
-typename LinkedListPriorityQueue<T>::Node* 
-LinkedListPriorityQueue<T>::findMaxNode() const {
+template <typename T, bool Stable>
+typename LinkedListPriorityQueue<T, Stable>::Node* 
+LinkedListPriorityQueue<T, Stable>::findMaxNode() const {
     if (empty()) {
         throw std::runtime_error("Kolejka priorytetowa jest pusta");
     }
@@ -139,7 +155,7 @@ LinkedListPriorityQueue<T>::findMaxNode() const {
     Node* current = head->next;    // Porównuj z następnymi
 
     while (current != nullptr) {
-        if (current->priority > maxNode->priority) {
+        if (current->key > maxNode->key) {
             maxNode = current;     // Znaleziono wyższy priorytet
         }
         current = current->next;   // Przejdź do następnego
@@ -149,9 +165,9 @@ LinkedListPriorityQueue<T>::findMaxNode() const {
 }
 
 // Znajduje węzeł zawierający dany element
-template <typename T>
-typename LinkedListPriorityQueue<T>::Node* 
-LinkedListPriorityQueue<T>::findNode(const T& e) const {
+template <typename T, bool Stable>
+typename LinkedListPriorityQueue<T, Stable>::Node* 
+LinkedListPriorityQueue<T, Stable>::findNode(const T& e) const {
     Node* current = head;
 
     while (current != nullptr) {
@@ -165,9 +181,9 @@ LinkedListPriorityQueue<T>::findNode(const T& e) const {
 }
 
 // Znajduje poprzednik danego węzła
-template <typename T>
-typename LinkedListPriorityQueue<T>::Node* 
-LinkedListPriorityQueue<T>::findPrevNode(Node* target) const {
+template <typename T, bool Stable>
+typename LinkedListPriorityQueue<T, Stable>::Node* 
+LinkedListPriorityQueue<T, Stable>::findPrevNode(Node* target) const {
     if (target == head) {
         return nullptr;            // Głowa nie ma poprzednika
     }
@@ -180,27 +196,31 @@ LinkedListPriorityQueue<T>::findPrevNode(Node* target) const {
 }
 
 // Wyświetla zawartość kolejki w kolejności malejących priorytetów
-template <typename T>
-void LinkedListPriorityQueue<T>::display() const {
+// Złożoność: O(n log n) - jedna kopia do tablicy i sortowanie przez kopcowanie
+template <typename T, bool Stable>
+void LinkedListPriorityQueue<T, Stable>::display() const {
     if (empty()) {
         std::cout << "Lista jest pusta." << std::endl;
         return;
     }
 
-    // Utwórz kopię do wyświetlenia (aby nie modyfikować oryginału)
-    LinkedListPriorityQueue<T> copy;
+    // Skopiuj pary (element, klucz) do tablicy (aby nie modyfikować oryginału)
+    typedef std::pair<T, typename Key::Type> Entry;
+    DynamicArray<Entry> entries(count);
     Node* current = head;
     while (current != nullptr) {
-        copy.insert(current->element, current->priority);
+        entries.push_back({current->element, current->key});
         current = current->next;
     }
 
+    // Sortowanie malejąco po kluczu
+    HeapSift::heapSort(entries.getData(), entries.getSize(),
+                       [](const Entry& a, const Entry& b) { return a.second > b.second; });
+
     // Wyświetl elementy w kolejności od najwyższego priorytetu
     std::cout << "Zawartosc listy (element: priorytet):" << std::endl;
-    while (!copy.empty()) {
-        T element = copy.extractMax();
-        int priority = copy.empty() ? 0 : copy.findMaxPriority();
-        std::cout << element << ": " << priority << std::endl;
+    for (size_t i = 0; i < entries.getSize(); ++i) {
+        std::cout << entries[i].first << ": " << Key::priority(entries[i].second) << std::endl;
     }
 }
 
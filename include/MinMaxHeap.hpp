@@ -0,0 +1,374 @@
+#ifndef MINMAXHEAP_HPP
+#define MINMAXHEAP_HPP
+
+#include "PriorityQueue.hpp"
+#include "DynamicArray.hpp"
+#include <stdexcept>  // Do obsługi wyjątków
+#include <utility>    // Dla std::pair
+#include <iostream>   // Do wyświetlania
+
+// Kopiec min-max (dwustronna kolejka priorytetowa): poziomy parzyste (korzeń)
+// są poziomami minimum, nieparzyste - maksimum. Element na poziomie minimum
+// jest nie większy od wszystkich w swoim poddrzewie, na poziomie maksimum -
+// nie mniejszy. Minimum leży w korzeniu, maksimum w jednym z jego dzieci.
+//
+// Tryb ograniczony (capacityLimit > 0): przy pełnej kolejce insert usuwa
+// element o najniższym priorytecie w O(log n) - nowy element zastępuje
+// minimum albo, jeśli sam ma priorytet nie wyższy od minimum, jest odrzucany.
+template <typename T>
+class MinMaxHeap : public PriorityQueue<T> {
+public:
+    // capacityLimit == 0 oznacza kolejkę bez ograniczenia rozmiaru
+    explicit MinMaxHeap(size_t capacityLimit = 0);
+
+    // Interfejs PriorityQueue
+    void insert(const T& e, int p) override;
+    T extractMax() override;
+    const T& findMax() const override;
+    void modifyKey(const T& e, int p) override;
+    size_t size() const override;
+    bool empty() const override;
+
+    void display() const override;  // Metoda pomocnicza do wyświetlania
+
+    // Operacje po stronie minimum
+    T extractMin();
+    const T& findMin() const;
+
+    // Zwraca priorytet elementu o najwyższym priorytecie
+    // Złożoność: O(1)
+    int findMaxPriority() const {
+        if (empty()) throw std::runtime_error("Kolejka jest pusta");
+        return heap.getData()[maxIndex()].second;
+    }
+
+    // Zwraca priorytet elementu o najniższym priorytecie
+    // Złożoność: O(1)
+    int findMinPriority() const {
+        if (empty()) throw std::runtime_error("Kolejka jest pusta");
+        return heap.getData()[0].second;
+    }
+
+    // Zwraca limit rozmiaru (0 - brak limitu)
+    size_t getCapacityLimit() const { return capacityLimit; }
+
+private:
+    typedef std::pair<T, int> Entry;  // Para (element, priorytet)
+
+    DynamicArray<Entry> heap;  // Przechowuje pary (element, priorytet)
+    size_t capacityLimit;      // Maksymalny rozmiar w trybie ograniczonym
+
+    // Porównanie "lepszy" dla poziomu: na poziomie maksimum większy priorytet,
+    // na poziomie minimum mniejszy
+    template <bool MaxLevel>
+    static bool better(const Entry& a, const Entry& b) {
+        return MaxLevel ? a.second > b.second : a.second < b.second;
+    }
+
+    // Czy indeks leży na poziomie minimum (parzysta głębokość)
+    // Złożoność: O(log n)
+    static bool isMinLevel(size_t i) {
+        size_t depth = 0;
+        for (size_t n = i + 1; n > 1; n >>= 1) ++depth;
+        return depth % 2 == 0;
+    }
+
+    // Indeks elementu o najwyższym priorytecie
+    size_t maxIndex() const;
+
+    // Umieszcza value na pozycji index i przywraca własność kopca
+    void place(size_t index, Entry value);
+
+    // Funkcje pomocnicze do utrzymywania własności kopca (metoda "dziury")
+    template <bool MaxLevel> void bubbleUp(size_t index, Entry value);
+    template <bool MaxLevel> void trickleDown(size_t index, Entry value);
+
+    // Usuwa element z pozycji index
+    void removeAt(size_t index);
+
+    // Znajduje indeks elementu w kopcu
+    // Złożoność: O(n) - liniowe przeszukiwanie
+    size_t findElementIndex(const T& e) const;
+};
+
+// Implementacja metod szablonowych
+
+template <typename T>
+MinMaxHeap<T>::MinMaxHeap(size_t capacityLimit) : capacityLimit(capacityLimit) {}
+
+/**
+ * Wstawia nowy element do kopca; w trybie ograniczonym przy pełnej kolejce
+ * usuwa element o najniższym priorytecie
+ * param e element do wstawienia
+ * param p priorytet elementu
+ * Złożoność: O(log n)
+ */
+template <typename T>
+void MinMaxHeap<T>::insert(const T& e, int p) {
+    if (capacityLimit > 0 && heap.getSize() >= capacityLimit) {
+        if (p <= heap.getData()[0].second) {
+            return;  // Nowy element byłby od razu usunięty jako minimum
+        }
+        trickleDown<false>(0, Entry(e, p));  // Zastąpienie minimum w korzeniu
+        return;
+    }
+    heap.push_back(Entry(e, p));
+    size_t last = heap.getSize() - 1;
+    place(last, std::move(heap.getData()[last]));
+}
+
+/**
+ * Usuwa i zwraca element o najwyższym priorytecie
+ * Złożoność: O(log n)
+ */
+template <typename T>
+T MinMaxHeap<T>::extractMax() {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    size_t index = maxIndex();
+    T maxElement = std::move(heap.getData()[index].first);
+    removeAt(index);
+    return maxElement;
+}
+
+/**
+ * Usuwa i zwraca element o najniższym priorytecie
+ * Złożoność: O(log n)
+ */
+template <typename T>
+T MinMaxHeap<T>::extractMin() {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    T minElement = std::move(heap.getData()[0].first);
+    removeAt(0);
+    return minElement;
+}
+
+/**
+ * Zwraca element o najwyższym priorytecie bez usuwania
+ * Złożoność: O(1)
+ */
+template <typename T>
+const T& MinMaxHeap<T>::findMax() const {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    return heap.getData()[maxIndex()].first;
+}
+
+/**
+ * Zwraca element o najniższym priorytecie bez usuwania
+ * Złożoność: O(1)
+ */
+template <typename T>
+const T& MinMaxHeap<T>::findMin() const {
+    if (empty()) {
+        throw std::runtime_error("Kolejka jest pusta");
+    }
+    return heap.getData()[0].first;
+}
+
+/**
+ * Modyfikuje priorytet elementu
+ * parametr e element do zmiany
+ * parametr p nowy priorytet
+ * Złożoność: O(n) dla wyszukiwania + O(log n) dla naprawy = O(n)
+ */
+template <typename T>
+void MinMaxHeap<T>::modifyKey(const T& e, int p) {
+    size_t index = findElementIndex(e);
+    Entry value = std::move(heap.getData()[index]);
+    value.second = p;
+    place(index, std::move(value));
+}
+
+/**
+ * Zwraca liczbę elementów w kopcu
+ * Złożoność: O(1)
+ */
+template <typename T>
+size_t MinMaxHeap<T>::size() const {
+    return heap.getSize();
+}
+
+/**
+ * Sprawdza czy kopiec jest pusty
+ * Złożoność: O(1)
+ */
+template <typename T>
+bool MinMaxHeap<T>::empty() const {
+    return heap.empty();
+}
+
+/**
+ * Indeks elementu o najwyższym priorytecie: korzeń albo większe z jego dzieci
+ * Złożoność: O(1)
+ */
+template <typename T>
+size_t MinMaxHeap<T>::maxIndex() const {
+    const Entry* h = heap.getData();
+    size_t n = heap.getSize();
+    if (n == 1) return 0;
+    if (n == 2) return 1;
+    return h[1].second >= h[2].second ? 1 : 2;
+}
+
+/**
+ * Umieszcza value na (zwolnionej) pozycji index i przywraca własność kopca.
+ * Jeśli value narusza porządek względem rodzica, zamienia się z nim miejscami
+ * i idzie w górę po poziomach rodzica, a rodzic schodzi w dół poddrzewa.
+ * W przeciwnym razie value idzie w górę po swoich poziomach albo w dół.
+ * Złożoność: O(log n)
+ */
+template <typename T>
+void MinMaxHeap<T>::place(size_t index, Entry value) {
+    Entry* h = heap.getData();
+    const bool minLevel = isMinLevel(index);
+
+    if (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (minLevel && value.second > h[parent].second) {
+            Entry down = std::move(h[parent]);
+            bubbleUp<true>(parent, std::move(value));
+            trickleDown<false>(index, std::move(down));
+            return;
+        }
+        if (!minLevel && value.second < h[parent].second) {
+            Entry down = std::move(h[parent]);
+            bubbleUp<false>(parent, std::move(value));
+            trickleDown<true>(index, std::move(down));
+            return;
+        }
+    }
+
+    // Względem rodzica porządek jest zachowany: w górę po dziadkach albo w dół
+    size_t grandparent = index > 2 ? ((index - 1) / 2 - 1) / 2 : index;
+    if (minLevel) {
+        if (index > 2 && value.second < h[grandparent].second) {
+            bubbleUp<false>(index, std::move(value));
+        } else {
+            trickleDown<false>(index, std::move(value));
+        }
+    } else {
+        if (index > 2 && value.second > h[grandparent].second) {
+            bubbleUp<true>(index, std::move(value));
+        } else {
+            trickleDown<true>(index, std::move(value));
+        }
+    }
+}
+
+/**
+ * Przesuwa value w górę po dziadkach (poziomy tego samego rodzaju)
+ * Złożoność: O(log n)
+ */
+template <typename T>
+template <bool MaxLevel>
+void MinMaxHeap<T>::bubbleUp(size_t index, Entry value) {
+    Entry* h = heap.getData();
+    while (index > 2) {
+        size_t grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!better<MaxLevel>(value, h[grandparent])) break;
+        h[index] = std::move(h[grandparent]);  // Dziadek schodzi do dziury
+        index = grandparent;
+    }
+    h[index] = std::move(value);
+}
+
+/**
+ * Przesuwa value w dół: na każdym kroku wybiera najlepszy element spośród
+ * dzieci i wnuków. Gdy wchodzi wnuk, value przechodzi do jego pozycji i
+ * ewentualnie zamienia się z rodzicem wnuka (poziom przeciwnego rodzaju).
+ * Złożoność: O(log n)
+ */
+template <typename T>
+template <bool MaxLevel>
+void MinMaxHeap<T>::trickleDown(size_t index, Entry value) {
+    Entry* h = heap.getData();
+    const size_t n = heap.getSize();
+    for (;;) {
+        size_t child = 2 * index + 1;
+        if (child >= n) break;
+
+        // Najlepszy spośród (do) 4 wnuków i 2 dzieci; przy remisie wygrywa
+        // wnuk, bo dziecko z potomkami nie może przyjąć value
+        size_t grandchild = 2 * child + 1;
+        size_t lastGrandchild = grandchild + 3 < n ? grandchild + 3 : n - 1;
+        size_t best = grandchild < n ? grandchild : child;
+        for (size_t g = grandchild + 1; g <= lastGrandchild; ++g) {
+            if (better<MaxLevel>(h[g], h[best])) best = g;
+        }
+        if (better<MaxLevel>(h[child], h[best])) best = child;
+        if (child + 1 < n && better<MaxLevel>(h[child + 1], h[best])) best = child + 1;
+
+        if (!better<MaxLevel>(h[best], value)) break;
+        h[index] = std::move(h[best]);
+        index = best;
+        if (best < grandchild) break;  // Dziecko - poniżej nie ma już naruszeń
+
+        size_t parent = (best - 1) / 2;
+        if (better<MaxLevel>(h[parent], value)) {
+            std::swap(h[parent], value);  // value trafia na poziom przeciwny
+        }
+    }
+    h[index] = std::move(value);
+}
+
+/**
+ * Usuwa element z pozycji index, wstawiając w jego miejsce ostatni element
+ * Złożoność: O(log n)
+ */
+template <typename T>
+void MinMaxHeap<T>::removeAt(size_t index) {
+    size_t last = heap.getSize() - 1;
+    Entry value = std::move(heap.getData()[last]);
+    heap.pop_back();
+    if (index < last) {
+        place(index, std::move(value));
+    }
+}
+
+/**
+ * Znajduje indeks elementu w kopcu
+ * Złożoność: O(n)
+ */
+template <typename T>
+size_t MinMaxHeap<T>::findElementIndex(const T& e) const {
+    const Entry* h = heap.getData();
+    for (size_t i = 0; i < heap.getSize(); ++i) {
+        if (h[i].first == e) {
+            return i;
+        }
+    }
+    throw std::runtime_error("Nie znaleziono elementu w kolejce");
+}
+
+/**
+ * Wyświetla zawartość kopca w porządku malejących priorytetów
+ * Złożoność: O(n log n) - tworzenie kopii i n operacji extractMax
+ */
+template <typename T>
+void MinMaxHeap<T>::display() const {
+    if (empty()) {
+        std::cout << "Kopiec jest pusty." << std::endl;
+        return;
+    }
+
+    // Utwórz kopię do wyświetlenia
+    MinMaxHeap<T> copy;
+    const Entry* h = heap.getData();
+    for (size_t i = 0; i < heap.getSize(); ++i) {
+        copy.insert(h[i].first, h[i].second);
+    }
+
+    std::cout << "Zawartosc kopca (element: priorytet):" << std::endl;
+    while (!copy.empty()) {
+        int priority = copy.findMaxPriority();
+        T element = copy.extractMax();
+        std::cout << element << ": " << priority << std::endl;
+    }
+}
+
+#endif // MINMAXHEAP_HPP
@@ -0,0 +1,112 @@
+#ifndef PARALLELHEAPSIFT_HPP
+#define PARALLELHEAPSIFT_HPP
+
+#include "HeapSift.hpp"
+#include <algorithm>  // Dla std::sort, std::inplace_merge
+#include <thread>     // Dla std::thread
+#include <vector>     // Lista wątków
+
+// Wielowątkowe odpowiedniki operacji z HeapSift dla bardzo dużych tablic.
+// Każde wywołanie uruchamia własne wątki robocze i czeka na ich zakończenie.
+namespace HeapSift {
+
+// Poniżej tego rozmiaru koszt uruchomienia wątków przewyższa zysk
+const size_t PARALLEL_MIN_SIZE = size_t(1) << 16;
+
+// Buduje kopiec (jak makeHeap) na wielu wątkach. Poddrzewa o korzeniach na
+// jednym poziomie są rozłączne, więc wybieramy poziom z co najmniej
+// 4 * threads węzłami, każdy wątek kopcuje od dołu swój ciągły zakres tych
+// poddrzew (na każdym poziomie poddrzewa zajmują ciągły fragment tablicy),
+// a kilka poziomów nad nimi kończy jeden wątek.
+// Złożoność: O(n / threads + threads * log n)
+template <typename E, typename Less>
+void makeHeapParallel(E* a, size_t n, Less less, unsigned threads) {
+    if (threads <= 1 || n < PARALLEL_MIN_SIZE) {
+        makeHeap(a, n, less);
+        return;
+    }
+
+    // Poziom podziału: 2^depth korzeni, zaczynając od indeksu 2^depth - 1
+    size_t depth = 0;
+    while ((size_t(1) << depth) < 4 * size_t(threads)) ++depth;
+    const size_t firstRoot = (size_t(1) << depth) - 1;
+    const size_t rootCount = size_t(1) << depth;
+    const size_t parents = n / 2;  // Węzły o indeksie < n / 2 mają dzieci
+
+    auto heapifyRoots = [=](size_t from, size_t to) {
+        // Poziomy od najgłębszego: na poziomie t poniżej korzeni zakres
+        // [from, to) korzeni ma potomków pod indeksami [(r + 1) * 2^t - 1, ...)
+        size_t levels = 0;
+        while ((((firstRoot + from + 1) << levels) - 1) < parents) ++levels;
+        for (size_t t = levels; t-- > 0;) {
+            size_t begin = ((firstRoot + from + 1) << t) - 1;
+            size_t end = ((firstRoot + to + 1) << t) - 1;
+            if (end > parents) end = parents;
+            for (size_t i = end; i-- > begin;) {
+                siftDown(a, n, i, less);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    const size_t chunk = (rootCount + threads - 1) / threads;
+    for (unsigned w = 0; w < threads; ++w) {
+        size_t from = w * chunk;
+        size_t to = from + chunk < rootCount ? from + chunk : rootCount;
+        if (from >= to) break;
+        workers.emplace_back(heapifyRoots, from, to);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Węzły powyżej poziomu podziału
+    for (size_t i = firstRoot < parents ? firstRoot : parents; i-- > 0;) {
+        siftDown(a, n, i, less);
+    }
+}
+
+// Sortuje tablicę rosnąco względem less na wielu wątkach: każdy wątek sortuje
+// swój fragment, po czym fragmenty są scalane parami (równolegle w każdej rundzie)
+// Złożoność: O((n log n) / threads + n log threads)
+template <typename E, typename Less>
+void sortParallel(E* a, size_t n, Less less, unsigned threads) {
+    if (threads <= 1 || n < PARALLEL_MIN_SIZE) {
+        std::sort(a, a + n, less);
+        return;
+    }
+
+    // Granice fragmentów
+    std::vector<size_t> bounds(threads + 1);
+    for (unsigned w = 0; w <= threads; ++w) {
+        bounds[w] = n / threads * w + (w < n % threads ? w : n % threads);
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned w = 0; w < threads; ++w) {
+        workers.emplace_back([=]() { std::sort(a + bounds[w], a + bounds[w + 1], less); });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Scalanie sąsiednich fragmentów parami aż zostanie jeden
+    for (size_t width = 1; width < threads; width *= 2) {
+        workers.clear();
+        for (size_t w = 0; w + width < threads; w += 2 * width) {
+            size_t first = bounds[w];
+            size_t middle = bounds[w + width];
+            size_t last = bounds[w + 2 * width < threads ? w + 2 * width : threads];
+            workers.emplace_back([=]() { std::inplace_merge(a + first, a + middle, a + last, less); });
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+} // namespace HeapSift
+
+#endif // PARALLELHEAPSIFT_HPP
@@ -0,0 +1,47 @@
+#ifndef PRIORITYKEY_HPP
+#define PRIORITYKEY_HPP
+
+#include <cstdint>  // Dla std::uint32_t, std::uint64_t
+
+// Klucz porównywany przez kolejki zamiast samego priorytetu.
+// Tryb zwykły: kluczem jest priorytet (int).
+// Tryb stabilny: priorytet i numer kolejny wstawienia są upakowane w jednej
+// liczbie 64-bitowej - starsze 32 bity to priorytet (przesunięty do zakresu
+// bez znaku), młodsze to odwrócony numer kolejny. Większy klucz oznacza wyższy
+// priorytet, a przy równych priorytetach - wcześniejsze wstawienie (FIFO).
+// Porównanie kluczy to jedno porównanie liczb, ale klucz ma 8 zamiast 4 bajtów:
+// wpis kopca (element, klucz) dla int rośnie z 8 do 16 bajtów, więc przy dużych
+// kopcach przesiewanie dotyka dwa razy więcej pamięci.
+template <bool Stable>
+struct PriorityKey;
+
+template <>
+struct PriorityKey<false> {
+    typedef int Type;
+
+    static Type make(int priority, std::uint32_t) { return priority; }
+    static int priority(Type key) { return key; }
+    static Type withPriority(Type, int priority) { return priority; }
+};
+
+template <>
+struct PriorityKey<true> {
+    typedef std::uint64_t Type;
+
+    static Type make(int priority, std::uint32_t sequence) {
+        return (static_cast<Type>(static_cast<std::uint32_t>(priority) ^ 0x80000000u) << 32) |
+               (0xFFFFFFFFu - sequence);
+    }
+    static int priority(Type key) {
+        return static_cast<int>(static_cast<std::uint32_t>(key >> 32) ^ 0x80000000u);
+    }
+    static std::uint32_t sequence(Type key) {
+        return 0xFFFFFFFFu - static_cast<std::uint32_t>(key);
+    }
+    // Zmiana priorytetu z zachowaniem numeru kolejnego (pozycji w kolejce FIFO)
+    static Type withPriority(Type key, int priority) {
+        return make(priority, sequence(key));
+    }
+};
+
+#endif // PRIORITYKEY_HPP
@@ -3,6 +3,8 @@
 #ifndef PRIORITYQUEUE_HPP
 #define PRIORITYQUEUE_HPP
 
+#include <cstddef>  // Dla size_t
+
 template <typename T>
 class PriorityQueue {
 public:
@@ -0,0 +1,73 @@
+#ifndef TOPKACCUMULATOR_HPP
+#define TOPKACCUMULATOR_HPP
+
+#include "DynamicArray.hpp"
+#include "HeapSift.hpp"
+#include <stdexcept>  // Do obsługi wyjątków
+#include <utility>    // Dla std::pair
+#include <vector>     // Wynik posortowany
+
+// Akumulator K elementów o najwyższych priorytetach ze strumienia danych.
+// Przechowuje kopiec minimum o stałym rozmiarze K: korzeń to najsłabszy z
+// zachowanych elementów, więc nowy element albo go zastępuje, albo odpada.
+// Cała pamięć jest alokowana w konstruktorze - push nie alokuje.
+template <typename T>
+class TopKAccumulator {
+public:
+    typedef std::pair<T, int> Entry;  // Para (element, priorytet)
+
+    // Konstruktor - rezerwuje miejsce na k elementów
+    // Złożoność: O(k)
+    explicit TopKAccumulator(size_t k) : k(k) {
+        if (k == 0) throw std::invalid_argument("K must be positive");
+        entries.reserve(k);
+    }
+
+    // Przetwarza kolejny element strumienia
+    // Złożoność: O(log k), O(1) gdy element odpada
+    void push(const T& e, int p) {
+        Entry* a = entries.getData();
+        if (entries.getSize() < k) {
+            entries.push_back(Entry(e, p));
+            HeapSift::siftUp(entries.getData(), entries.getSize() - 1, Greater());
+        } else if (p > a[0].second) {
+            a[0] = Entry(e, p);  // Zastąpienie najsłabszego
+            HeapSift::siftDown(a, k, 0, Greater());
+        }
+    }
+
+    // Najniższy priorytet wśród zachowanych - próg wejścia, gdy akumulator jest pełny
+    // Złożoność: O(1)
+    int thresholdPriority() const {
+        if (entries.empty()) throw std::runtime_error("Akumulator jest pusty");
+        return entries.getData()[0].second;
+    }
+
+    // Zwraca liczbę zachowanych elementów (najwyżej K)
+    size_t size() const { return entries.getSize(); }
+
+    // Sprawdza czy akumulator jest pusty
+    bool empty() const { return entries.empty(); }
+
+    // Usuwa wszystkie elementy (bez zwalniania pamięci)
+    void clear() { entries.clear(); }
+
+    // Zwraca zachowane elementy w kolejności malejących priorytetów
+    // Złożoność: O(k log k)
+    std::vector<Entry> sortedResults() const {
+        std::vector<Entry> result(entries.getData(), entries.getData() + entries.getSize());
+        HeapSift::sortHeap(result.data(), result.size(), Greater());  // Kopiec minimum -> malejąco
+        return result;
+    }
+
+private:
+    // Porządek odwrócony - kopiec minimum według priorytetu
+    struct Greater {
+        bool operator()(const Entry& a, const Entry& b) const { return a.second > b.second; }
+    };
+
+    DynamicArray<Entry> entries;  // Kopiec minimum zachowanych elementów
+    size_t k;                     // Maksymalna liczba zachowanych elementów
+};
+
+#endif // TOPKACCUMULATOR_HPP
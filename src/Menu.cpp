@@ -3,9 +3,12 @@
 #include <string>
 #include <random>
 #include <stdexcept>
+#include <climits>
 #include "PriorityQueue.hpp"
 #include "Heap.hpp"
 #include "LinkedListPriorityQueue.hpp"
+#include "BlockedHeap.hpp"
+#include "MinMaxHeap.hpp"
 
 using namespace std;
 
@@ -164,15 +167,19 @@ void structureMenu(PriorityQueue<T>& pq, const string& structureName) {
 int main() {
     Heap<int> heapQueue;
     LinkedListPriorityQueue<int> linkedListQueue;
+    BlockedHeap<int> blockedHeapQueue;
+    MinMaxHeap<int> minMaxHeapQueue;
     
     while (true) {
         clearScreen();
         cout << "=== MENU GLOWNE ===" << endl;
         cout << "1. Testuj kopiec binarny" << endl;
         cout << "2. Testuj liste wiazana" << endl;
-        cout << "3. Zakoncz program" << endl;
+        cout << "3. Testuj kopiec blokowy" << endl;
+        cout << "4. Testuj kopiec min-max" << endl;
+        cout << "5. Zakoncz program" << endl;
         
-        int choice = getIntInput("Wybierz opcje: ", 1, 3);
+        int choice = getIntInput("Wybierz opcje: ", 1, 5);
         
         switch (choice) {
             case 1:
@@ -182,6 +189,12 @@ int main() {
                 structureMenu<int>(linkedListQueue, "Lista Wiazana");
                 break;
             case 3:
+                structureMenu<int>(blockedHeapQueue, "Kopiec Blokowy");
+                break;
+            case 4:
+                structureMenu<int>(minMaxHeapQueue, "Kopiec Min-Max");
+                break;
+            case 5:
                 return 0;
         }
     }
@@ -3,9 +3,25 @@
 #include <chrono>
 #include <fstream>
 #include <numeric>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 #include "Heap.hpp"
 #include "LinkedListPriorityQueue.hpp"
+#include "BlockedHeap.hpp"
+#include "MinMaxHeap.hpp"
+#include "TopKAccumulator.hpp"
+#include "ExternalPriorityQueue.hpp"
+#include "BlockingPriorityQueue.hpp"
+#include "HeapSift.hpp"
+#include "DynamicArray.hpp"
 
 // Klasa generatora liczb losowych z określonego zakresu
 class RandomGenerator {
@@ -119,7 +135,679 @@ void testStructurePerformance(const std::vector<std::pair<int, int>>& data,
     out.close();
 }
 
+// Predykat porównujący priorytety, który zlicza wykonane porównania
+struct CountingLess {
+    long long* counter;
+    bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
+        ++*counter;
+        return a.second < b.second;
+    }
+};
+
+// Poprzednia wersja przesiewania w dół: rekurencja, swap na każdym poziomie
+// i dostęp z kontrolą zakresu (at) - punkt odniesienia dla HeapSift
+void legacyHeapifyDown(std::vector<std::pair<int, int>>& h, size_t index, CountingLess less) {
+    size_t maxIndex = index;
+    size_t left = 2 * index + 1;
+    size_t right = 2 * index + 2;
+    if (left < h.size() && less(h.at(maxIndex), h.at(left))) maxIndex = left;
+    if (right < h.size() && less(h.at(maxIndex), h.at(right))) maxIndex = right;
+    if (index != maxIndex) {
+        std::swap(h.at(index), h.at(maxIndex));
+        legacyHeapifyDown(h, maxIndex, less);
+    }
+}
+
+// Porównanie wariantów przesiewania przy opróżnianiu kopca (extractMax):
+// liczba porównań i czas na jedno usunięcie
+void testSiftVariants(const std::vector<std::pair<int, int>>& data) {
+    std::cout << "Testing sift variants...\n";
+
+    // Kopiec zbudowany raz, każdy wariant opróżnia własną kopię
+    std::vector<std::pair<int, int>> base(data);
+    long long unused = 0;
+    for (size_t i = base.size() / 2; i-- > 0;) {
+        HeapSift::siftDown(base.data(), base.size(), i, CountingLess{&unused});
+    }
+
+    const double n = static_cast<double>(data.size());
+    std::ofstream out("Sift_results.csv", std::ios::app);
+    out << data.size();
+
+    for (int variant = 0; variant < 3; ++variant) {
+        std::vector<std::pair<int, int>> h(base);
+        long long comparisons = 0;
+        CountingLess less{&comparisons};
+
+        double time = measureAvgTime([&]() {
+            while (!h.empty()) {
+                size_t last = h.size() - 1;
+                h[0] = h[last];
+                h.pop_back();
+                if (last <= 1) continue;
+                if (variant == 0) {
+                    legacyHeapifyDown(h, 0, less);
+                } else if (variant == 1) {
+                    HeapSift::siftDown(h.data(), last, 0, less);
+                } else {
+                    HeapSift::siftDownFloyd(h.data(), last, 0, less);
+                }
+            }
+        }, 1);
+
+        out << "," << comparisons / n << "," << time / n;
+    }
+    out << "\n";
+    out.close();
+}
+
+// Zwraca wartość pola (w kB) z /proc/self/status, np. VmHWM (szczytowe RSS)
+// lub VmRSS (bieżące RSS); 0 gdy niedostępne (system inny niż Linux)
+long readProcStatusKb(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size() + 1, field + ":") == 0) {
+            return std::stol(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+// Zeruje licznik szczytowego RSS procesu (Linux: zapis "5" do clear_refs)
+void resetPeakRss() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) clearRefs << "5";
+}
+
+// Porównanie polityk wzrostu DynamicArray: czas narastania do n elementów,
+// szczytowe RSS oraz RSS po opróżnieniu tablicy (oba względem RSS przed testem)
+void testGrowthPolicies(size_t n) {
+    std::cout << "Testing growth policies for " << n << " elements...\n";
+
+    const char* names[] = {"Double", "Factor1.5", "Reserve", "Mmap"};
+    for (int policy = 0; policy < 4; ++policy) {
+        resetPeakRss();
+        const long baseRss = readProcStatusKb("VmRSS");
+        double rampUpTime = 0;
+        long peakRss = 0;
+        long rssAfterDrain = 0;
+        {
+            DynamicArray<std::pair<int, int>> array;
+            array.setAutoShrink(true);
+            if (policy == 1) array.setGrowthFactor(1.5);
+            if (policy == 3) array.setUseMmap(true);
+
+            rampUpTime = measureAvgTime([&]() {
+                if (policy == 2) array.reserve(n);
+                for (size_t i = 0; i < n; ++i) {
+                    array.push_back({static_cast<int>(i), static_cast<int>(i)});
+                }
+            }, 1);
+            peakRss = readProcStatusKb("VmHWM");
+
+            while (!array.empty()) {
+                array.pop_back();
+            }
+            rssAfterDrain = readProcStatusKb("VmRSS");
+        }
+
+        std::ofstream out("Growth_results.csv", std::ios::app);
+        out << n << "," << names[policy] << ","
+            << rampUpTime / 1000.0 << ","
+            << peakRss - baseRss << ","
+            << rssAfterDrain - baseRss << "\n";
+    }
+}
+
+// Czas wstawiania i usuwania maksimum (na operację) dla danej struktury kopca
+template<typename PriorityQueue>
+void measureInsertExtract(PriorityQueue& pq, const std::vector<std::pair<int, int>>& data,
+                          std::ofstream& out) {
+    double insertTime = measureAvgTime([&]() {
+        for (const auto& item : data) {
+            pq.insert(item.first, item.second);
+        }
+    }, 1);
+    double extractTime = measureAvgTime([&]() {
+        while (!pq.empty()) {
+            pq.extractMax();
+        }
+    }, 1);
+    out << "," << insertTime / data.size() << "," << extractTime / data.size();
+}
+
+// Porównanie układu klasycznego (Heap) z blokowym (BlockedHeap) dla kopców
+// większych niż pamięć podręczna ostatniego poziomu
+void testHeapLayouts(const std::vector<std::pair<int, int>>& data) {
+    std::cout << "Testing heap layouts...\n";
+
+    std::ofstream out("Layout_results.csv", std::ios::app);
+    out << data.size();
+    {
+        Heap<int> heap;
+        heap.configureStorage(2.0, false, true);  // Ta sama pamięć (mmap) co BlockedHeap
+        measureInsertExtract(heap, data, out);
+    }
+    {
+        BlockedHeap<int> blocked;  // Bloki wielkości linii cache
+        measureInsertExtract(blocked, data, out);
+    }
+    {
+        BlockedHeap<int, 4096> paged;  // Bloki wielkości strony
+        measureInsertExtract(paged, data, out);
+    }
+    out << "\n";
+}
+
+// Kolejka ograniczona: strumień wszystkich danych przez MinMaxHeap o limicie
+// capacity (usuwanie minimum przy przepełnieniu) - czas na jeden insert
+void testBoundedEviction(const std::vector<std::pair<int, int>>& data, size_t capacity) {
+    std::cout << "Testing bounded MinMaxHeap...\n";
+
+    MinMaxHeap<int> bounded(capacity);
+    double insertTime = measureAvgTime([&]() {
+        for (const auto& item : data) {
+            bounded.insert(item.first, item.second);
+        }
+    }, 1);
+
+    std::ofstream out("Bounded_results.csv", std::ios::app);
+    out << data.size() << "," << capacity << "," << insertTime / data.size() << "\n";
+}
+
+// Wybór K największych: akumulator strumieniowy, HeapSift::partialSort,
+// std::partial_sort oraz przegląd frontu gotowego kopca (Heap::forEachTopK).
+// Czasy całkowite w mikrosekundach.
+void testTopK(const std::vector<std::pair<int, int>>& data) {
+    std::cout << "Testing top-K...\n";
+
+    auto byPriority = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.second < b.second;
+    };
+    auto byPriorityDesc = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.second > b.second;
+    };
+
+    Heap<int> heap;
+    for (const auto& item : data) {
+        heap.insert(item.first, item.second);
+    }
+
+    std::ofstream out("TopK_results.csv", std::ios::app);
+    for (size_t k : {10u, 100u, 1000u}) {
+        if (k > data.size()) continue;
+
+        double accumulatorTime = measureAvgTime([&]() {
+            TopKAccumulator<int> acc(k);
+            for (const auto& item : data) {
+                acc.push(item.first, item.second);
+            }
+            volatile auto top = acc.sortedResults().front().second;
+        }, 1);
+
+        std::vector<std::pair<int, int>> copy(data);
+        double partialSortTime = measureAvgTime([&]() {
+            HeapSift::partialSort(copy.data(), copy.size(), k, byPriority);
+        }, 1);
+
+        copy = data;
+        double stdPartialSortTime = measureAvgTime([&]() {
+            std::partial_sort(copy.begin(), copy.begin() + k, copy.end(), byPriorityDesc);
+        }, 1);
+
+        double frontierTime = measureAvgTime([&]() {
+            long long sum = 0;
+            heap.forEachTopK(k, [&sum](int, int priority) { sum += priority; });
+            volatile long long result = sum;
+        }, 1);
+
+        out << data.size() << "," << k << ","
+            << accumulatorTime << ","
+            << partialSortTime << ","
+            << stdPartialSortTime << ","
+            << frontierTime << "\n";
+    }
+}
+
+// Narzut trybu stabilnego (FIFO): czasy wstawiania i extractMax na operację.
+// priorityClasses > 0 - tyle klas priorytetów (dużo powtórzeń),
+// priorityClasses == 0 - priorytety unikalne (losowa permutacja)
+void testStableOverhead(size_t size, int priorityClasses) {
+    std::cout << "Testing stable mode...\n";
+
+    std::vector<std::pair<int, int>> data;
+    data.reserve(size);
+    if (priorityClasses > 0) {
+        RandomGenerator rg(0, priorityClasses - 1);
+        for (size_t i = 0; i < size; ++i) {
+            data.emplace_back(static_cast<int>(i), rg.generate());
+        }
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            data.emplace_back(static_cast<int>(i), static_cast<int>(i));
+        }
+        std::shuffle(data.begin(), data.end(), std::mt19937(std::random_device{}()));
+    }
+
+    std::ofstream out("Stable_results.csv", std::ios::app);
+    out << size << "," << priorityClasses;
+    {
+        Heap<int> plain;
+        measureInsertExtract(plain, data, out);
+    }
+    {
+        Heap<int, true> stable;
+        measureInsertExtract(stable, data, out);
+    }
+    out << "\n";
+}
+
+// Kontrola poprawności trybu stabilnego: losowy ciąg insert / modifyKey /
+// extractMax na Heap<int, true> i LinkedListPriorityQueue<int, true> musi dać
+// tę samą kolejność elementów co model odniesienia (priorytet malejąco, przy
+// remisie wcześniejsze wstawienie; modifyKey zachowuje pozycję w kolejce FIFO)
+bool checkStableOrder(size_t operations) {
+    std::cout << "Checking stable order...\n";
+
+    Heap<int, true> heap;
+    LinkedListPriorityQueue<int, true> list;
+    std::vector<std::pair<int, int>> reference;  // (element, priorytet) w kolejności wstawiania
+    RandomGenerator operationGen(0, 9);
+    RandomGenerator priorityGen(0, 7);           // Mało klas - dużo remisów
+    int nextElement = 0;
+
+    for (size_t i = 0; i < operations; ++i) {
+        int operation = operationGen.generate();
+        if (operation < 5 || reference.empty()) {
+            int p = priorityGen.generate();
+            heap.insert(nextElement, p);
+            list.insert(nextElement, p);
+            reference.emplace_back(nextElement++, p);
+        } else if (operation < 7) {
+            RandomGenerator indexGen(0, static_cast<int>(reference.size()) - 1);
+            std::pair<int, int>& item = reference[indexGen.generate()];
+            item.second = priorityGen.generate();
+            heap.modifyKey(item.first, item.second);
+            list.modifyKey(item.first, item.second);
+        } else {
+            // Pierwszy w kolejności wstawiania spośród najwyższego priorytetu
+            size_t best = 0;
+            for (size_t j = 1; j < reference.size(); ++j) {
+                if (reference[j].second > reference[best].second) best = j;
+            }
+            int expected = reference[best].first;
+            reference.erase(reference.begin() + best);
+            if (heap.extractMax() != expected || list.extractMax() != expected) {
+                std::cout << "BLAD: rozna kolejnosc w trybie stabilnym\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Kopiec z indeksem pozycji (tablica haszująca element -> indeks w tablicy),
+// tylko do porównania z trybem leniwym: modifyKey ma ten sam koszt wyszukania
+// elementu co tryb leniwy, po czym przesiewa w O(log n), aktualizując indeks
+// przy każdym przesunięciu wpisu
+class PositionIndexedHeap {
+public:
+    void insert(int e, int p) {
+        entries.emplace_back(e, p);
+        position[e] = entries.size() - 1;
+        siftUp(entries.size() - 1);
+    }
+
+    int extractMax() {
+        int top = entries[0].first;
+        position.erase(top);
+        std::pair<int, int> last = entries.back();
+        entries.pop_back();
+        if (!entries.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        return top;
+    }
+
+    void modifyKey(int e, int p) {
+        size_t index = position.at(e);
+        int oldPriority = entries[index].second;
+        entries[index].second = p;
+        if (p > oldPriority) {
+            siftUp(index);
+        } else if (p < oldPriority) {
+            siftDown(index);
+        }
+    }
+
+private:
+    std::vector<std::pair<int, int>> entries;    // Pary (element, priorytet)
+    std::unordered_map<int, size_t> position;    // Indeks elementu w entries
+
+    void place(size_t index, const std::pair<int, int>& entry) {
+        entries[index] = entry;
+        position[entry.first] = index;
+    }
+
+    void siftUp(size_t index) {
+        std::pair<int, int> value = entries[index];
+        while (index > 0) {
+            size_t parent = (index - 1) / 2;
+            if (entries[parent].second >= value.second) break;
+            place(index, entries[parent]);
+            index = parent;
+        }
+        place(index, value);
+    }
+
+    void siftDown(size_t index) {
+        std::pair<int, int> value = entries[index];
+        const size_t n = entries.size();
+        for (size_t child = 2 * index + 1; child < n; child = 2 * index + 1) {
+            if (child + 1 < n && entries[child + 1].second > entries[child].second) ++child;
+            if (entries[child].second <= value.second) break;
+            place(index, entries[child]);
+            index = child;
+        }
+        place(index, value);
+    }
+};
+
+// Mieszanka operacji: updates wywołań modifyKey, co updatesPerExtract - extractMax.
+// Zwraca czas na operację w mikrosekundach (budowa kopca nie jest mierzona).
+template<typename PriorityQueue>
+double measureModifyKeyMix(PriorityQueue& pq, const std::vector<std::pair<int, int>>& data,
+                           int updates) {
+    const int updatesPerExtract = 100;
+    for (const auto& item : data) {
+        pq.insert(item.first, item.second);
+    }
+
+    std::vector<bool> removed(data.size(), false);
+    RandomGenerator indexGen(0, data.size() - 1);
+    RandomGenerator priorityGen(0, 1000000);
+
+    double time = measureAvgTime([&]() {
+        for (int i = 1; i <= updates; ++i) {
+            int index = indexGen.generate();
+            while (removed[index]) index = indexGen.generate();
+            pq.modifyKey(data[index].first, priorityGen.generate());
+            if (i % updatesPerExtract == 0) {
+                removed[pq.extractMax()] = true;
+            }
+        }
+    }, 1);
+    return time / (updates + updates / updatesPerExtract);
+}
+
+// Zmiany priorytetów znacznie częstsze niż usuwanie (100 modifyKey na jedno
+// extractMax). Trzy warianty modifyKey, czas na operację w mikrosekundach:
+// - Heap bez trybu leniwego: wyszukiwanie liniowe O(n) + przesiewanie,
+// - PositionIndexedHeap: wyszukiwanie w tablicy haszującej + przesiewanie
+//   O(log n) z aktualizacją indeksu,
+// - tryb leniwy: wyszukiwanie w tablicy haszującej + nowy wpis (przesiewanie
+//   w górę) i zamortyzowana kompakcja.
+// Dwa ostatnie różnią się tylko przesiewaniem, więc ich porównanie pokazuje
+// zysk z wpisów nieaktualnych. Przy nich updates = 2n, aby objąć kompakcję.
+void testLazyModifyKey(const std::vector<std::pair<int, int>>& data) {
+    std::cout << "Testing lazy modifyKey...\n";
+
+    const int scanUpdates = 1000;
+    const int updates = static_cast<int>(2 * data.size());
+
+    std::ofstream out("Lazy_results.csv", std::ios::app);
+    out << data.size();
+    {
+        Heap<int> eager;
+        out << "," << measureModifyKeyMix(eager, data, scanUpdates);
+    }
+    {
+        PositionIndexedHeap indexed;
+        out << "," << measureModifyKeyMix(indexed, data, updates);
+    }
+    {
+        Heap<int, false, true> lazy;
+        lazy.setLazyMode(true);
+        out << "," << measureModifyKeyMix(lazy, data, updates);
+    }
+    out << "\n";
+}
+
+// Skalowanie budowy kopca z par i opróżniania w kolejności malejącej
+// względem liczby wątków: 1, 2, 4, ... aż do liczby rdzeni. Czasy w ms.
+void testParallelScaling(const std::vector<std::pair<int, int>>& data) {
+    std::cout << "Testing parallel build and drain...\n";
+
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < cores; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(cores);
+
+    std::ofstream out("Parallel_results.csv", std::ios::app);
+    for (unsigned threads : threadCounts) {
+        Heap<int> pq;
+        double buildTime = measureAvgTime([&]() { pq.build(data, threads); }, 1);
+        double drainTime = measureAvgTime([&]() { pq.drainSorted(threads); }, 1);
+        out << data.size() << "," << threads << ","
+            << buildTime / 1000.0 << "," << drainTime / 1000.0 << "\n";
+    }
+}
+
+// Kolejka zewnętrzna z buforem bufferCapacity elementów i blokami 64 KiB na
+// danych kilkukrotnie większych od jej limitu pamięci (bufor + bloki przebiegów,
+// kolumna MemoryLimitBytes), w porównaniu z kopcem w pamięci.
+// Czasy w mikrosekundach na operację.
+void testExternalQueue(const std::vector<std::pair<int, int>>& data, size_t bufferCapacity) {
+    std::cout << "Testing external queue...\n";
+
+    const double n = static_cast<double>(data.size());
+    std::ofstream out("External_results.csv", std::ios::app);
+    out << data.size() << "," << bufferCapacity;
+    {
+        ExternalPriorityQueue<int> pq(bufferCapacity, 64 * 1024);
+        out << "," << pq.memoryLimitBytes();
+        double insertTime = measureAvgTime([&]() {
+            for (const auto& item : data) pq.insert(item.first, item.second);
+        }, 1);
+        size_t runs = pq.runCount();
+        double extractTime = measureAvgTime([&]() {
+            while (!pq.empty()) pq.extractMax();
+        }, 1);
+        out << "," << runs << "," << insertTime / n << "," << extractTime / n;
+    }
+    {
+        Heap<int> pq;
+        double insertTime = measureAvgTime([&]() {
+            for (const auto& item : data) pq.insert(item.first, item.second);
+        }, 1);
+        double extractTime = measureAvgTime([&]() {
+            while (!pq.empty()) pq.extractMax();
+        }, 1);
+        out << "," << insertTime / n << "," << extractTime / n;
+    }
+    out << "\n";
+}
+
+// Kolejka znaczników czasu: równe priorytety, stabilny kopiec - kolejność FIFO
+typedef BlockingPriorityQueue<long long, Heap<long long, true>> TimestampQueue;
+
+// Bieżący czas w nanosekundach (znacznik wstawiany jako element)
+long long nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Korutyna uruchamiana bez oczekiwania na wynik - ramka zwalnia się sama po zakończeniu
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+// Wątek konsumenta jako wykonawca dla popAsync: producent tylko wstawia
+// uchwyt korutyny, a wznowienie odbywa się w tym wątku
+class ResumeThread {
+public:
+    ResumeThread() : worker([this]() { run(); }) {}
+
+    ~ResumeThread() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        ready.notify_one();
+        worker.join();
+    }
+
+    TimestampQueue::Executor executor() {
+        return [this](std::coroutine_handle<> handle) { post(handle); };
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::coroutine_handle<>> handles;  // Korutyny do wznowienia
+    bool stopping = false;
+    std::thread worker;                           // Inicjalizowany jako ostatni
+
+    void post(std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            handles.push_back(handle);
+        }
+        ready.notify_one();
+    }
+
+    // Wznawia korutyny w kolejności wstawienia; kończy po zatrzymaniu i opróżnieniu
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            ready.wait(lock, [this]() { return stopping || !handles.empty(); });
+            if (handles.empty()) return;
+            std::coroutine_handle<> handle = handles.front();
+            handles.pop_front();
+            lock.unlock();
+            handle.resume();
+            lock.lock();
+        }
+    }
+};
+
+// Konsument-korutyna: sumuje opóźnienia od wstawienia do odebrania;
+// pusty executor - wznowienie w wątku producenta
+DetachedTask timestampConsumer(TimestampQueue& queue, TimestampQueue::Executor executor,
+                               long long& latencySum, size_t& received) {
+    while (std::optional<long long> stamp = co_await queue.popAsync(executor)) {
+        latencySum += nowNs() - *stamp;
+        ++received;
+    }
+}
+
+// Przepustowość producent-konsument: items elementów od producers wątków do
+// consumers wątków, średnie opóźnienie od push do pop w mikrosekundach
+void testBlockingThroughput(size_t producers, size_t consumers, size_t items) {
+    std::cout << "Testing blocking queue: " << producers << "x" << consumers << "\n";
+
+    TimestampQueue queue;
+    std::atomic<long long> latencySum(0);
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&]() {
+            long long localSum = 0;
+            while (std::optional<long long> stamp = queue.pop()) {
+                localSum += nowNs() - *stamp;
+            }
+            latencySum += localSum;
+        });
+    }
+    std::vector<std::thread> producerThreads;
+    for (size_t p = 0; p < producers; ++p) {
+        producerThreads.emplace_back([&, p]() {
+            size_t count = items / producers + (p < items % producers ? 1 : 0);
+            for (size_t i = 0; i < count; ++i) {
+                queue.push(nowNs(), 0);
+            }
+        });
+    }
+    for (std::thread& producer : producerThreads) producer.join();
+    queue.close();
+    for (std::thread& consumer : threads) consumer.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::ofstream out("Blocking_results.csv", std::ios::app);
+    out << "threads," << producers << "," << consumers << "," << items << ","
+        << items / seconds << "," << latencySum / 1000.0 / items << "\n";
+}
+
+// Opóźnienie wybudzenia: konsument czeka na pustej kolejce, producent
+// wstawia znacznik czasu co 100 mikrosekund. Porównywalne wiersze to
+// wakeup-thread (wątek na zmiennej warunkowej) i wakeup-coroutine (korutyna
+// wznawiana przez ResumeThread, czyli też przejście do innego wątku).
+// resume-coroutine-inline to korutyna bez wykonawcy, wznawiana wewnątrz push
+// w wątku producenta - zwykłe wywołanie funkcji, a nie wybudzenie, podane
+// tylko jako dolna granica kosztu samego przekazania elementu.
+void testWakeupLatency(size_t samples) {
+    std::cout << "Testing wakeup latency...\n";
+
+    std::ofstream out("Blocking_results.csv", std::ios::app);
+    {
+        TimestampQueue queue;
+        long long latencySum = 0;
+        std::thread consumer([&]() {
+            while (std::optional<long long> stamp = queue.pop()) {
+                latencySum += nowNs() - *stamp;
+            }
+        });
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < samples; ++i) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            queue.push(nowNs(), 0);
+        }
+        queue.close();
+        consumer.join();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        out << "wakeup-thread,1,1," << samples << "," << samples / seconds << ","
+            << latencySum / 1000.0 / samples << "\n";
+    }
+    for (bool inlineResume : {false, true}) {
+        TimestampQueue queue;
+        long long latencySum = 0;
+        size_t received = 0;
+        auto start = std::chrono::steady_clock::now();
+        {
+            ResumeThread resumer;
+            TimestampQueue::Executor executor;
+            if (!inlineResume) executor = resumer.executor();
+            timestampConsumer(queue, executor, latencySum, received);  // Zawiesza się na pustej kolejce
+            std::thread producer([&]() {
+                for (size_t i = 0; i < samples; ++i) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    queue.push(nowNs(), 0);
+                }
+                queue.close();
+            });
+            producer.join();
+        }  // ResumeThread kończy po wznowieniu wszystkich korutyn
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        out << (inlineResume ? "resume-coroutine-inline" : "wakeup-coroutine") << ",1,1,"
+            << received << "," << received / seconds << "," << latencySum / 1000.0 / received << "\n";
+    }
+}
+
 int main() {
+    if (!checkStableOrder(20000)) {
+        return 1;
+    }
+
     // Rozmiary danych do testowania
     const std::vector<int> sizes = {5000, 8000, 10000, 16000, 20000, 
                                    40000, 60000, 100000, 200000, 500000};
@@ -132,6 +820,61 @@ int main() {
     std::ofstream ll_out("LinkedList_results.csv");
     ll_out << "Size,InsertTime,SizeTime,FindMaxTime,ExtractMaxTime,ModifyKeyTime\n";
     ll_out.close();
+
+    std::ofstream sift_out("Sift_results.csv");
+    sift_out << "Size,SwapComparisons,SwapTime,HoleComparisons,HoleTime,FloydComparisons,FloydTime\n";
+    sift_out.close();
+
+    std::ofstream bl_out("BlockedHeap_results.csv");
+    bl_out << "Size,InsertTime,SizeTime,FindMaxTime,ExtractMaxTime,ModifyKeyTime\n";
+    bl_out.close();
+
+    std::ofstream mm_out("MinMaxHeap_results.csv");
+    mm_out << "Size,InsertTime,SizeTime,FindMaxTime,ExtractMaxTime,ModifyKeyTime\n";
+    mm_out.close();
+
+    std::ofstream bounded_out("Bounded_results.csv");
+    bounded_out << "Size,Capacity,InsertTime\n";
+    bounded_out.close();
+
+    std::ofstream topk_out("TopK_results.csv");
+    topk_out << "Size,K,AccumulatorTime,HeapPartialSortTime,StdPartialSortTime,HeapFrontierTime\n";
+    topk_out.close();
+
+    std::ofstream stable_out("Stable_results.csv");
+    stable_out << "Size,PriorityClasses,PlainInsertTime,PlainExtractMaxTime,StableInsertTime,StableExtractMaxTime\n";
+    stable_out.close();
+
+    std::ofstream lazy_out("Lazy_results.csv");
+    lazy_out << "Size,EagerScanOpTime,EagerIndexedOpTime,LazyOpTime\n";
+    lazy_out.close();
+
+    std::ofstream layout_out("Layout_results.csv");
+    layout_out << "Size,HeapInsertTime,HeapExtractMaxTime,BlockedInsertTime,BlockedExtractMaxTime,"
+               << "PagedInsertTime,PagedExtractMaxTime\n";
+    layout_out.close();
+
+    std::ofstream parallel_out("Parallel_results.csv");
+    parallel_out << "Size,Threads,BuildTimeMs,DrainTimeMs\n";
+    parallel_out.close();
+
+    std::ofstream external_out("External_results.csv");
+    external_out << "Size,BufferCapacity,MemoryLimitBytes,Runs,ExternalInsertTime,ExternalExtractMaxTime,"
+                 << "HeapInsertTime,HeapExtractMaxTime\n";
+    external_out.close();
+
+    std::ofstream blocking_out("Blocking_results.csv");
+    blocking_out << "Mode,Producers,Consumers,Items,ThroughputOpsPerSec,AvgLatencyUs\n";
+    blocking_out.close();
+
+    std::ofstream growth_out("Growth_results.csv");
+    growth_out << "Size,Policy,RampUpTimeMs,PeakRssKB,RssAfterDrainKB\n";
+    growth_out.close();
+
+    // Narastanie i opróżnianie dużych tablic (niezależne od struktur kolejek)
+    for (size_t n : {1000000u, 10000000u}) {
+        testGrowthPolicies(n);
+    }
     
     // Test dla każdego rozmiaru danych
     for (int size : sizes) {
@@ -147,7 +890,57 @@ int main() {
         // Testowanie obu struktur na tych samych danych
         testStructurePerformance<Heap<int>>(data, "Heap");
         testStructurePerformance<LinkedListPriorityQueue<int>>(data, "LinkedList");
+        testStructurePerformance<BlockedHeap<int>>(data, "BlockedHeap");
+        testStructurePerformance<MinMaxHeap<int>>(data, "MinMaxHeap");
+        testBoundedEviction(data, 1000);
+        testTopK(data);
+        testStableOverhead(data.size(), 16);
+        testStableOverhead(data.size(), 0);
+        testLazyModifyKey(data);
+        testSiftVariants(data);
+        testHeapLayouts(data);
+    }
+
+    // Duże kopce (do 50M elementów) - tylko wstawianie i extractMax, bo
+    // modifyKey i lista wiązana są tu O(n) na operację
+    const std::vector<int> largeSizes = {1000000, 2000000, 5000000, 10000000,
+                                         20000000, 50000000};
+    for (int size : largeSizes) {
+        std::cout << "Testing size: " << size << "\n";
+
+        RandomGenerator rg(0, 1000000);
+        std::vector<std::pair<int, int>> data;
+        data.reserve(size);
+        for (int i = 0; i < size; ++i) {
+            data.emplace_back(i, rg.generate());
+        }
+
+        testHeapLayouts(data);
+        testParallelScaling(data);
+    }
+
+    // Kolejka zewnętrzna: dane (8 B na element) 4-32 razy większe niż bufor,
+    // czyli ok. 2.6-21 razy większe niż cały limit pamięci kolejki
+    const size_t externalBuffer = 1000000;
+    for (size_t factor : {4u, 8u, 16u, 32u}) {
+        size_t size = factor * externalBuffer;
+        std::cout << "Testing size: " << size << "\n";
+
+        RandomGenerator rg(0, 1000000);
+        std::vector<std::pair<int, int>> data;
+        data.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            data.emplace_back(static_cast<int>(i), rg.generate());
+        }
+
+        testExternalQueue(data, externalBuffer);
+    }
+
+    // Kolejka blokująca producent-konsument
+    for (size_t threads : {1u, 2u, 4u}) {
+        testBlockingThroughput(threads, threads, 1000000);
     }
+    testWakeupLatency(2000);
     
     std::cout << "Koniec";
     return 0;